@@ -3,27 +3,26 @@
 
 AutoParser::AutoParser(const DetermAutomaton &_myAuto) : myAuto{_myAuto}
 {
-    currentStates.push_back(std::pair("", myAuto.nodes[*myAuto.begin()]));
+    currentStates.push_back(std::pair("", myAuto.begin().getCurrent()));
 }
 
 void AutoParser::parse()
 {
     while (!currentStates.empty())
     {
-        std::pair<std::string, const DetermAutomaton::Node *> myPair = currentStates.front();
+        std::pair<std::string, int> myPair = currentStates.front();
         currentStates.pop_front();
         const std::string word = myPair.first;
-        const DetermAutomaton::Node *currentNode = myPair.second;
-        std::vector<std::pair<const char, const DetermAutomaton::Node *>> nexts = currentNode->getNext();
-        parseState(nexts, currentNode, word);
+        int currentNode = myPair.second;
+        parseState(myAuto.nodes[currentNode].getNext(), currentNode, word);
     }
     for (int i = 0; i < myAuto.finalNodes.size(); ++i)
     {
         if (myAuto.finalNodes[i] == myAuto.first)
         {
-            statesLanguage[myAuto.finalNodes[i]->getNodeName()].push_back("@");
+            statesLanguage[myAuto.finalNodes[i]].push_back("@");
         }
-        std::vector<std::string> words = statesLanguage[myAuto.finalNodes[i]->getNodeName()];
+        std::vector<std::string> words = statesLanguage[myAuto.finalNodes[i]];
         std::string currentStateLanguage;
         compress(words, currentStateLanguage);
         if (i == 0)
@@ -52,7 +51,7 @@ void AutoParser::compress(const std::vector<std::string> &words, std::string &ex
     expression += ")";
 }
 
-void AutoParser::parseState(const std::vector<std::pair<const char, const DetermAutomaton::Node *>> &nexts, const DetermAutomaton::Node *currentNode, const std::string &word)
+void AutoParser::parseState(const std::vector<std::pair<char, int>> &nexts, int currentNode, const std::string &word)
 {
     for (int i = 0; i < nexts.size(); ++i)
     {
@@ -62,7 +61,7 @@ void AutoParser::parseState(const std::vector<std::pair<const char, const Determ
         {
             prevStates.insert(nexts[i].second);
             currentStates.push_back(std::pair(word + nexts[i].first, nexts[i].second));
-            statesLanguage[nexts[i].second->getNodeName()].push_back(word + nexts[i].first);
+            statesLanguage[nexts[i].second].push_back(word + nexts[i].first);
         }
         else if (!path.empty())
         {
@@ -75,17 +74,17 @@ void AutoParser::parseState(const std::vector<std::pair<const char, const Determ
             {
                 compress(path, fullExpresion);
             }
-            std::set<std::string> excludedNodes;
-            statesLanguage[currentNode->getNodeName()].push_back("(" + word + "(" + nexts[i].first + fullExpresion + ")*)");
-            excludedNodes.insert(currentNode->getNodeName());
-            excludedNodes.insert(nexts[i].second->getNodeName());
+            std::set<int> excludedNodes;
+            statesLanguage[currentNode].push_back("(" + word + "(" + nexts[i].first + fullExpresion + ")*)");
+            excludedNodes.insert(currentNode);
+            excludedNodes.insert(nexts[i].second);
             changeNexts(currentNode, excludedNodes);
-            statesLanguage[nexts[i].second->getNodeName()].push_back("(" + word + "(" + nexts[i].first + fullExpresion + ")*" + nexts[i].first + ")");
+            statesLanguage[nexts[i].second].push_back("(" + word + "(" + nexts[i].first + fullExpresion + ")*" + nexts[i].first + ")");
             changeNexts(nexts[i].second, excludedNodes);
         }
         else
         {
-            statesLanguage[nexts[i].second->getNodeName()].push_back(word + nexts[i].first);
+            statesLanguage[nexts[i].second].push_back(word + nexts[i].first);
         }
     }
 }
@@ -101,15 +100,15 @@ std::ostream &operator<<(std::ostream &out, const AutoParser &myParser)
     return out;
 }
 
-void AutoParser::changeNexts(const DetermAutomaton::Node *currentNode, std::set<std::string> &excludedNodes)
+void AutoParser::changeNexts(int currentNode, std::set<int> &excludedNodes)
 {
-    std::vector<std::pair<const char, const DetermAutomaton::Node *>> nexts = currentNode->getNext();
+    const std::vector<std::pair<char, int>> &nexts = myAuto.nodes[currentNode].getNext();
     for (int i = 0; i < nexts.size(); ++i)
     {
-        if (excludedNodes.count(nexts[i].second->getNodeName()) == 0)
+        if (excludedNodes.count(nexts[i].second) == 0)
         {
-            excludedNodes.insert(nexts[i].second->getNodeName());
-            statesLanguage[nexts[i].second->getNodeName()].push_back(statesLanguage[currentNode->getNodeName()].back() + nexts[i].first);
+            excludedNodes.insert(nexts[i].second);
+            statesLanguage[nexts[i].second].push_back(statesLanguage[currentNode].back() + nexts[i].first);
             changeNexts(nexts[i].second, excludedNodes);
         }
     }
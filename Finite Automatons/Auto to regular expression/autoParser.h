@@ -13,16 +13,16 @@
 class AutoParser
 {
     DetermAutomaton myAuto;
-    std::deque<std::pair<std::string, const DetermAutomaton::Node *>> currentStates;
-    std::set<const DetermAutomaton::Node *> prevStates;
-    std::map<std::string, std::vector<std::string>> statesLanguage;
+    std::deque<std::pair<std::string, int>> currentStates;
+    std::set<int> prevStates;
+    std::map<int, std::vector<std::string>> statesLanguage;
     std::string regExpression;
 
     ///parses a state to a regular expression of the language of the state
-    void parseState(const std::vector<std::pair<const char, const DetermAutomaton::Node *>> &nexts, const DetermAutomaton::Node *currentNode, const std::string &word);
+    void parseState(const std::vector<std::pair<char, int>> &nexts, int currentNode, const std::string &word);
 
     ///changes the languages of the next states
-    void changeNexts(const DetermAutomaton::Node *currentNode, std::set<std::string> &);
+    void changeNexts(int currentNode, std::set<int> &);
 
 public:
     AutoParser() = delete;
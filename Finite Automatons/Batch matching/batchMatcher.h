@@ -0,0 +1,63 @@
+#ifndef BATCH_MATCHER_H
+#define BATCH_MATCHER_H
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "threadPool.h"
+
+///class BatchMatcher checks many words against a read-only automaton on the threads of a pool
+///the automaton must have a const isWordFromAuto(std::string_view), e.g. CompiledDetermAutomaton
+template <class Automaton>
+class BatchMatcher
+{
+    ///every task checks a multiple of 64 words so that no two tasks write to the same word of the bitmap
+    static constexpr std::size_t WORDS_PER_TASK = 64 * 64;
+
+    const Automaton &myAuto;
+    ThreadPool &pool;
+
+public:
+    BatchMatcher() = delete;
+
+    BatchMatcher(const Automaton &_myAuto, ThreadPool &_pool) : myAuto{_myAuto}, pool{_pool} {}
+
+    ///returns a bitmap in which bit i is set when words[i] is from the language of the auto
+    std::vector<std::uint64_t> areWordsFromAuto(const std::vector<std::string_view> &words) const
+    {
+        std::vector<std::uint64_t> bitmap((words.size() + 63) / 64, 0);
+        int tasksCount = (words.size() + WORDS_PER_TASK - 1) / WORDS_PER_TASK;
+        pool.run(tasksCount, [&](int task)
+                 {
+                     std::size_t end = std::min(words.size(), (task + 1) * WORDS_PER_TASK);
+                     for (std::size_t i = task * WORDS_PER_TASK; i < end; ++i)
+                     {
+                         if (myAuto.isWordFromAuto(words[i]))
+                         {
+                             bitmap[i / 64] |= std::uint64_t(1) << (i % 64);
+                         }
+                     } });
+        return bitmap;
+    }
+
+    ///checks the words buffer[offsets[i], offsets[i + 1]) and returns a bitmap with offsets.size() - 1 bits
+    std::vector<std::uint64_t> areWordsFromAuto(const std::string &buffer, const std::vector<std::size_t> &offsets) const
+    {
+        std::vector<std::string_view> words;
+        for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+        {
+            words.push_back(std::string_view(buffer.data() + offsets[i], offsets[i + 1] - offsets[i]));
+        }
+        return areWordsFromAuto(words);
+    }
+
+    ///checks whether bit i of the bitmap is set
+    static bool isWordAccepted(const std::vector<std::uint64_t> &bitmap, std::size_t i)
+    {
+        return (bitmap[i / 64] >> (i % 64)) & 1;
+    }
+};
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef LINE_SCANNER_H
+#define LINE_SCANNER_H
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include "threadPool.h"
+#include "../Regular expressions to auto/literalPrefilter.h"
+
+///class LineScanner checks every line of a text against a read-only automaton on the threads of a pool
+///the text is split into chunks which end at a new line, a '\r' before the new line is not part of the line
+///with a prefilter of the expression of the auto the lines without its literals are skipped
+template <class Automaton>
+class LineScanner
+{
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 1 << 20;
+
+    const Automaton &myAuto;
+    ThreadPool &pool;
+    std::size_t chunkSize;
+    const LiteralPrefilter *prefilter;
+
+    ///returns the offsets at which the chunks start, the last one is the size of the text
+    std::vector<std::size_t> splitToChunks(std::string_view text) const
+    {
+        std::vector<std::size_t> starts{0};
+        while (text.size() - starts.back() > chunkSize)
+        {
+            std::size_t offset = starts.back() + chunkSize;
+            const void *newLine = std::memchr(text.data() + offset, '\n', text.size() - offset);
+            if (!newLine)
+            {
+                break;
+            }
+            std::size_t next = static_cast<const char *>(newLine) - text.data() + 1;
+            if (next == text.size())
+            {
+                break;
+            }
+            starts.push_back(next);
+        }
+        starts.push_back(text.size());
+        return starts;
+    }
+
+    ///calls onLine with the index in the chunk of every matching line and returns the number of lines
+    template <class Function>
+    std::size_t scanChunk(std::string_view chunk, const Function &onLine) const
+    {
+        std::size_t linesCount = 0;
+        std::size_t begin = 0;
+        while (begin < chunk.size())
+        {
+            const void *newLine = std::memchr(chunk.data() + begin, '\n', chunk.size() - begin);
+            std::size_t end = newLine ? static_cast<const char *>(newLine) - chunk.data() : chunk.size();
+            std::size_t lineEnd = (end > begin && chunk[end - 1] == '\r') ? end - 1 : end;
+            std::string_view line = chunk.substr(begin, lineEnd - begin);
+            if ((!prefilter || prefilter->mayBeWord(line)) && myAuto.isWordFromAuto(line))
+            {
+                onLine(linesCount);
+            }
+            ++linesCount;
+            begin = end + 1;
+        }
+        return linesCount;
+    }
+
+public:
+    LineScanner() = delete;
+
+    LineScanner(const Automaton &_myAuto, ThreadPool &_pool, std::size_t _chunkSize = DEFAULT_CHUNK_SIZE,
+                const LiteralPrefilter *_prefilter = nullptr)
+        : myAuto{_myAuto}, pool{_pool}, chunkSize{_chunkSize ? _chunkSize : DEFAULT_CHUNK_SIZE}, prefilter{_prefilter} {}
+
+    ///returns the numbers, starting from 1, of the lines which are words from the language of the auto
+    std::vector<std::size_t> getMatchingLines(std::string_view text) const
+    {
+        std::vector<std::size_t> starts = splitToChunks(text);
+        int chunksCount = starts.size() - 1;
+        std::vector<std::vector<std::size_t>> matches(chunksCount);
+        std::vector<std::size_t> linesCounts(chunksCount);
+        pool.run(chunksCount, [&](int chunk)
+                 { linesCounts[chunk] = scanChunk(text.substr(starts[chunk], starts[chunk + 1] - starts[chunk]),
+                                                  [&](std::size_t line)
+                                                  { matches[chunk].push_back(line); }); });
+        std::vector<std::size_t> result;
+        std::size_t firstLine = 1;
+        for (int i = 0; i < chunksCount; ++i)
+        {
+            for (int j = 0; j < matches[i].size(); ++j)
+            {
+                result.push_back(firstLine + matches[i][j]);
+            }
+            firstLine += linesCounts[i];
+        }
+        return result;
+    }
+
+    ///returns the number of lines which are words from the language of the auto
+    std::size_t countMatchingLines(std::string_view text) const
+    {
+        std::vector<std::size_t> starts = splitToChunks(text);
+        int chunksCount = starts.size() - 1;
+        std::vector<std::size_t> counts(chunksCount, 0);
+        pool.run(chunksCount, [&](int chunk)
+                 { scanChunk(text.substr(starts[chunk], starts[chunk + 1] - starts[chunk]),
+                             [&](std::size_t)
+                             { ++counts[chunk]; }); });
+        std::size_t result = 0;
+        for (int i = 0; i < chunksCount; ++i)
+        {
+            result += counts[i];
+        }
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,107 @@
+#include <stdexcept>
+#include "mappedFile.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string &path) : data{nullptr}, size{0}, fileHandle{nullptr}, mappingHandle{nullptr}
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::invalid_argument("Cannot open file " + path);
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw std::invalid_argument("Cannot read the size of file " + path);
+    }
+    size = fileSize.QuadPart;
+    fileHandle = file;
+    if (size == 0)
+    {
+        return;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        throw std::invalid_argument("Cannot map file " + path);
+    }
+    mappingHandle = mapping;
+    data = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!data)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::invalid_argument("Cannot map file " + path);
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data)
+    {
+        UnmapViewOfFile(data);
+    }
+    if (mappingHandle)
+    {
+        CloseHandle(mappingHandle);
+    }
+    CloseHandle(fileHandle);
+}
+#else
+MappedFile::MappedFile(const std::string &path) : data{nullptr}, size{0}
+{
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        throw std::invalid_argument("Cannot open file " + path);
+    }
+    struct stat fileInfo;
+    if (fstat(file, &fileInfo) < 0)
+    {
+        close(file);
+        throw std::invalid_argument("Cannot read the size of file " + path);
+    }
+    size = fileInfo.st_size;
+    if (size == 0)
+    {
+        close(file);
+        return;
+    }
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::invalid_argument("Cannot map file " + path);
+    }
+    madvise(mapping, size, MADV_SEQUENTIAL);
+    data = static_cast<const char *>(mapping);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data)
+    {
+        munmap(const_cast<char *>(data), size);
+    }
+}
+#endif
+
+std::string_view MappedFile::getView() const
+{
+    return std::string_view(data, size);
+}
+
+std::size_t MappedFile::getSize() const
+{
+    return size;
+}
@@ -0,0 +1,35 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+///class MappedFile maps a whole file read-only into memory
+class MappedFile
+{
+    const char *data;
+    std::size_t size;
+#ifdef _WIN32
+    void *fileHandle;
+    void *mappingHandle;
+#endif
+
+public:
+    MappedFile() = delete;
+
+    ///throws std::invalid_argument when the file can not be opened or mapped
+    MappedFile(const std::string &path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ///returns the contents of the file, valid while the MappedFile is alive
+    std::string_view getView() const;
+
+    std::size_t getSize() const;
+};
+
+#endif
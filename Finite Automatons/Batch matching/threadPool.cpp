@@ -0,0 +1,95 @@
+#include "threadPool.h"
+
+ThreadPool::ThreadPool(int threadsCount) : tasksCount{0}, nextTask{0}, finishedTasks{0}, isStopping{false}
+{
+    if (threadsCount <= 0)
+    {
+        threadsCount = std::thread::hardware_concurrency();
+    }
+    for (int i = 1; i < threadsCount; ++i)
+    {
+        workers.push_back(std::thread(&ThreadPool::work, this));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        isStopping = true;
+    }
+    hasWork.notify_all();
+    for (int i = 0; i < workers.size(); ++i)
+    {
+        workers[i].join();
+    }
+}
+
+void ThreadPool::runTasks(std::unique_lock<std::mutex> &lock)
+{
+    while (nextTask < tasksCount)
+    {
+        int index = nextTask++;
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+            task(index);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if (error && !firstError)
+        {
+            firstError = error;
+        }
+        if (++finishedTasks == tasksCount)
+        {
+            isDone.notify_all();
+        }
+    }
+}
+
+void ThreadPool::work()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        hasWork.wait(lock, [this]
+                     { return isStopping || nextTask < tasksCount; });
+        if (isStopping)
+        {
+            return;
+        }
+        runTasks(lock);
+    }
+}
+
+void ThreadPool::run(int newTasksCount, const std::function<void(int)> &newTask)
+{
+    std::unique_lock<std::mutex> runLock(runMutex);
+    std::unique_lock<std::mutex> lock(mutex);
+    task = newTask;
+    tasksCount = newTasksCount;
+    nextTask = 0;
+    finishedTasks = 0;
+    hasWork.notify_all();
+    runTasks(lock);
+    isDone.wait(lock, [this]
+                { return finishedTasks == tasksCount; });
+    tasksCount = 0;
+    nextTask = 0;
+    std::exception_ptr error = firstError;
+    firstError = nullptr;
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+int ThreadPool::getThreadsCount() const
+{
+    return workers.size() + 1;
+}
@@ -0,0 +1,50 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+
+///class ThreadPool keeps worker threads alive and runs numbered tasks on them
+class ThreadPool
+{
+    std::vector<std::thread> workers;
+    std::mutex runMutex;
+    std::mutex mutex;
+    std::condition_variable hasWork;
+    std::condition_variable isDone;
+
+    std::function<void(int)> task;
+    int tasksCount;
+    int nextTask;
+    int finishedTasks;
+    bool isStopping;
+    ///the first exception thrown by a task of the current run
+    std::exception_ptr firstError;
+
+    ///takes tasks until there are no more, the lock is released while a task runs
+    void runTasks(std::unique_lock<std::mutex> &);
+
+    void work();
+
+public:
+    ///uses as many threads as the hardware supports when threadsCount is 0
+    ThreadPool(int threadsCount = 0);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ///runs the task with every index from 0 to tasksCount - 1 and waits for all of them to finish,
+    ///then rethrows the first exception thrown by a task
+    void run(int tasksCount, const std::function<void(int)> &task);
+
+    ///returns the number of threads including the calling one
+    int getThreadsCount() const;
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <map>
+#include "byteClasses.h"
+
+ByteClasses::ByteClasses() : signatures(ALPHABET_SIZE), classes(ALPHABET_SIZE, 0), classChars(1)
+{
+    for (int symbol = 0; symbol < ALPHABET_SIZE; ++symbol)
+    {
+        classChars[0].push_back((char)symbol);
+    }
+}
+
+void ByteClasses::add(int from, const char &symbol, int to)
+{
+    signatures[(unsigned char)symbol].push_back(std::pair(from, to));
+}
+
+void ByteClasses::build()
+{
+    std::map<std::vector<std::pair<int, int>>, int> classIndices;
+    classChars.clear();
+    for (int symbol = 0; symbol < ALPHABET_SIZE; ++symbol)
+    {
+        std::sort(signatures[symbol].begin(), signatures[symbol].end());
+        signatures[symbol].erase(std::unique(signatures[symbol].begin(), signatures[symbol].end()), signatures[symbol].end());
+        auto found = classIndices.find(signatures[symbol]);
+        if (found == classIndices.end())
+        {
+            found = classIndices.insert(std::pair(signatures[symbol], (int)classChars.size())).first;
+            classChars.push_back(std::string());
+        }
+        classes[symbol] = found->second;
+        classChars[found->second].push_back((char)symbol);
+    }
+    signatures.assign(ALPHABET_SIZE, std::vector<std::pair<int, int>>());
+}
+
+int ByteClasses::getClass(const char &symbol) const
+{
+    return classes[(unsigned char)symbol];
+}
+
+int ByteClasses::getClassesCount() const
+{
+    return classChars.size();
+}
+
+const std::string &ByteClasses::getChars(int byteClass) const
+{
+    return classChars[byteClass];
+}
+
+const std::vector<unsigned char> &ByteClasses::getClasses() const
+{
+    return classes;
+}
@@ -0,0 +1,38 @@
+#ifndef BYTE_CLASSES_H
+#define BYTE_CLASSES_H
+#include <string>
+#include <vector>
+#include <utility>
+
+///class ByteClasses splits the chars to classes of chars which the transitions of an automaton do not tell apart
+class ByteClasses
+{
+    static constexpr int ALPHABET_SIZE = 256;
+
+    std::vector<std::vector<std::pair<int, int>>> signatures;
+    std::vector<unsigned char> classes;
+    std::vector<std::string> classChars;
+
+public:
+    ///all chars are in class 0 until build() is called
+    ByteClasses();
+
+    ///adds a transition between two numbered states which the classes must tell apart
+    void add(int from, const char &symbol, int to);
+
+    ///splits the chars to classes after all transitions are added
+    void build();
+
+    ///returns the class of the char
+    int getClass(const char &) const;
+
+    int getClassesCount() const;
+
+    ///returns all chars from the class
+    const std::string &getChars(int) const;
+
+    ///returns the class of every char
+    const std::vector<unsigned char> &getClasses() const;
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include <stdexcept>
+#include "compiledDetermAuto.h"
+
+CompiledDetermAutomaton::CompiledDetermAutomaton(const DetermAutomaton &myAuto) : first{DEAD_STATE}
+{
+    if (myAuto.isEmpty())
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+
+    // the states are shifted by one to keep 0 for the dead state
+    int statesCount = myAuto.nodes.size() + 1;
+    ByteClasses byteClasses;
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
+    {
+        const std::vector<std::pair<char, int>> &nexts = myAuto.nodes[i].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
+        {
+            byteClasses.add(i + 1, nexts[k].first, nexts[k].second + 1);
+        }
+    }
+    byteClasses.build();
+    classes = byteClasses.getClasses();
+    classesCount = byteClasses.getClassesCount();
+
+    table.assign(statesCount * classesCount, DEAD_STATE);
+    finals.assign(statesCount, false);
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
+    {
+        int row = (i + 1) * classesCount;
+        const std::vector<std::pair<char, int>> &nexts = myAuto.nodes[i].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
+        {
+            table[row + classes[(unsigned char)nexts[k].first]] = nexts[k].second + 1;
+        }
+    }
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
+    {
+        finals[i + 1] = myAuto.finals[i];
+    }
+    first = myAuto.first + 1;
+
+    // the states from which no final state is reached, e.g. sinks, are replaced by the dead state,
+    // the others are found going back from the final states
+    std::vector<std::vector<int>> previous(statesCount);
+    for (int i = 0; i < table.size(); ++i)
+    {
+        previous[table[i]].push_back(i / classesCount);
+    }
+    std::vector<char> isLive(statesCount, false);
+    std::vector<int> listOfStates;
+    for (int state = 0; state < statesCount; ++state)
+    {
+        if (finals[state])
+        {
+            isLive[state] = true;
+            listOfStates.push_back(state);
+        }
+    }
+    for (int i = 0; i < listOfStates.size(); ++i)
+    {
+        const std::vector<int> &states = previous[listOfStates[i]];
+        for (int k = 0; k < states.size(); ++k)
+        {
+            if (!isLive[states[k]])
+            {
+                isLive[states[k]] = true;
+                listOfStates.push_back(states[k]);
+            }
+        }
+    }
+    for (int i = 0; i < table.size(); ++i)
+    {
+        if (!isLive[table[i]])
+        {
+            table[i] = DEAD_STATE;
+        }
+    }
+    if (!isLive[first])
+    {
+        first = DEAD_STATE;
+    }
+}
+
+bool CompiledDetermAutomaton::isWordFromAuto(std::string_view transitionWord) const
+{
+    const int *row = table.data();
+    const unsigned char *charClasses = classes.data();
+    int state = first;
+    for (int i = 0; i < transitionWord.size(); ++i)
+    {
+        state = row[state * classesCount + charClasses[(unsigned char)transitionWord[i]]];
+    }
+    return finals[state];
+}
+
+int CompiledDetermAutomaton::begin() const
+{
+    return first;
+}
+
+int CompiledDetermAutomaton::transition(int state, const char &transitionChar) const
+{
+    return table[state * classesCount + classes[(unsigned char)transitionChar]];
+}
+
+bool CompiledDetermAutomaton::isFinalState(int state) const
+{
+    return finals[state];
+}
+
+bool CompiledDetermAutomaton::isDeadState(int state) const
+{
+    return state == DEAD_STATE;
+}
+
+int CompiledDetermAutomaton::getStatesCount() const
+{
+    return finals.size();
+}
+
+int CompiledDetermAutomaton::getClassesCount() const
+{
+    return classesCount;
+}
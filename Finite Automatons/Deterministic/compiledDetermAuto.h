@@ -0,0 +1,49 @@
+#ifndef COMPILED_DETERMINISTIC_AUTOMATON_H
+#define COMPILED_DETERMINISTIC_AUTOMATON_H
+#include <string>
+#include <string_view>
+#include <vector>
+#include "determAuto.h"
+#include "byteClasses.h"
+
+///class CompiledDetermAutomaton is a read-only table form of a deterministic automaton used for fast matching
+class CompiledDetermAutomaton
+{
+    ///state 0 is a dead state which loops to itself with every char
+    static constexpr int DEAD_STATE = 0;
+
+    int first;
+    int classesCount;
+    ///the class of every char, the table has a column for every class
+    std::vector<unsigned char> classes;
+    std::vector<int> table;
+    std::vector<char> finals;
+
+public:
+    CompiledDetermAutomaton() = delete;
+
+    CompiledDetermAutomaton(const DetermAutomaton &);
+
+    ///checks whether the word is from the language of the auto
+    bool isWordFromAuto(std::string_view) const;
+
+    ///returns the starting state
+    int begin() const;
+
+    ///returns the state reached from the state with the char
+    int transition(int state, const char &transitionChar) const;
+
+    ///checks whether the state is final
+    bool isFinalState(int state) const;
+
+    ///checks whether no word can be accepted from the state
+    bool isDeadState(int state) const;
+
+    ///returns the number of states including the dead state
+    int getStatesCount() const;
+
+    ///returns the number of columns of the transition table
+    int getClassesCount() const;
+};
+
+#endif
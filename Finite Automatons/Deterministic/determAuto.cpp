@@ -6,68 +6,30 @@
 #include <unordered_map>
 #include <exception>
 #include <cstring>
+#include <type_traits>
 #include "determAuto.h"
 
-void DetermAutomaton::Node::copy(const DetermAutomaton::Node &other)
+const std::vector<std::pair<char, int>> &DetermAutomaton::Node::getNext() const
 {
-    this->nodeName = other.nodeName;
-    this->next.clear();
-}
-
-void DetermAutomaton::deleteNodes()
-{
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
-    {
-        delete i->second;
-    }
-}
-
-DetermAutomaton::Node::Node(const Node &other)
-{
-    copy(other);
+    return next;
 }
 
-typename DetermAutomaton::Node &DetermAutomaton::Node::operator=(const Node &other)
+int DetermAutomaton::Node::add(const char &transitionChar, int node)
 {
-    if (this != &other)
+    int existingNode = hasSymbolTransition(transitionChar);
+    if (existingNode == NO_NODE)
     {
-        copy(other);
+        next.push_back(std::pair<char, int>(transitionChar, node));
     }
-    return *this;
+    return existingNode;
 }
 
-std::string DetermAutomaton::Node::getNodeName() const
+void DetermAutomaton::Node::append(const char &transitionChar, int node)
 {
-    return nodeName;
-}
-
-std::vector<std::pair<const char, const DetermAutomaton::Node *>> DetermAutomaton::Node::getNext() const
-{
-    return next;
-}
-
-void DetermAutomaton::Node::pushBackToName(const char &symbol)
-{
-    nodeName.push_back(symbol);
-}
-
-void DetermAutomaton::Node::add(const char &transitionChar, const Node *node)
-{
-    if (hasSymbolTransition(transitionChar) == node)
-    {
-        throw std::overflow_error("There is already the same transition.\n");
-    }
-    else if (hasSymbolTransition(transitionChar))
-    {
-        throw std::overflow_error("Nondeterministic actions.\n");
-    }
-    else
-    {
-        next.push_back(std::pair<const char, const Node *>(transitionChar, node));
-    }
+    next.push_back(std::pair<char, int>(transitionChar, node));
 }
 
-typename DetermAutomaton::Node const *DetermAutomaton::Node::hasSymbolTransition(const char &transitionChar) const
+int DetermAutomaton::Node::hasSymbolTransition(const char &transitionChar) const
 {
     for (int i = 0; i < next.size(); ++i)
     {
@@ -76,7 +38,7 @@ typename DetermAutomaton::Node const *DetermAutomaton::Node::hasSymbolTransition
             return next[i].second;
         }
     }
-    return nullptr;
+    return NO_NODE;
 }
 
 bool DetermAutomaton::AutoIterator::operator!=(const AutoIterator &other)
@@ -91,126 +53,86 @@ bool DetermAutomaton::AutoIterator::operator==(const AutoIterator &other)
 
 std::string DetermAutomaton::AutoIterator::operator*()
 {
-    if (!current)
+    if (current == NO_NODE)
     {
         throw std::out_of_range("There is no node!\n");
     }
-    return current->getNodeName();
+    return automaton->names[current].toString();
 }
 
 DetermAutomaton::AutoIterator &DetermAutomaton::AutoIterator::transition(const char &transitionChar, const DetermAutomaton &automaton)
 {
-    if (!this->current)
+    if (current == NO_NODE)
     {
         throw std::out_of_range("nullptr");
     }
-    const DetermAutomaton::Node *newNode = current->hasSymbolTransition(transitionChar);
-
-    if (!newNode)
-    {
-        current = nullptr;
-    }
-    else
-    {
-        current = newNode;
-    }
+    current = automaton.nodes[current].hasSymbolTransition(transitionChar);
     return *this;
 }
 
 void DetermAutomaton::copy(const DetermAutomaton &other)
 {
-    deleteNodes();
-    copyTransitions(other);
-    first = nodes[other.first->getNodeName()];
-    copyFinals(other);
+    first = other.first;
+    nodes = other.nodes;
+    finals = other.finals;
+    finalNodes = other.finalNodes;
+    names = other.names;
+    nameIndices = other.nameIndices;
+    indexedNodesCount = other.indexedNodesCount;
 }
 
-void DetermAutomaton::copyTransitions(const DetermAutomaton &other)
+void DetermAutomaton::move(DetermAutomaton &other) noexcept
 {
-    int size = other.nodes.size();
-    int prevSize = nodes.size();
-    std::vector<std::string> listOfNodes;
-    std::unordered_map<std::string, int> listOfIndices;
-    std::string **adjacencyMatrix = new std::string *[size];
-    for (int i = 0; i < size; ++i)
-    {
-        std::string *arr = new std::string[size];
-        adjacencyMatrix[i] = arr;
-    }
-
-    int counter = 0;
-    for (auto i = other.nodes.begin(); i != other.nodes.end(); i++)
-    {
-        Node *node = new Node(i->second->getNodeName());
-        this->nodes[node->getNodeName()] = node;
-        listOfNodes.push_back(i->second->getNodeName());
-        listOfIndices[i->second->getNodeName()] = counter++;
-    }
-    other.buildAdjencyMatrix(adjacencyMatrix, listOfNodes, listOfIndices, (prevSize > 0));
-
-    for (int rows = 0; rows < size; ++rows)
-    {
-        copyTransitionsHelper(rows, size, adjacencyMatrix, listOfNodes, other);
-    }
+    first = other.first;
+    nodes = std::move(other.nodes);
+    finals = std::move(other.finals);
+    finalNodes = std::move(other.finalNodes);
+    names = std::move(other.names);
+    nameIndices = std::move(other.nameIndices);
+    indexedNodesCount = other.indexedNodesCount;
+    other.first = NO_NODE;
+    other.nodes.clear();
+    other.finals.clear();
+    other.finalNodes.clear();
+    other.names.clear();
+    other.nameIndices.clear();
+    other.indexedNodesCount = 0;
 }
 
-void DetermAutomaton::copyTransitionsHelper(const int &rows, const int &size, std::string **adjacencyMatrix, const std::vector<std::string> &listOfNodes, const DetermAutomaton &other)
+int DetermAutomaton::addNode(const StateName &nodeName)
 {
-    for (int cols = 0; cols < size; ++cols)
+    int index = nodes.size();
+    nodes.push_back(Node());
+    finals.push_back(false);
+    names.push_back(nodeName);
+    if (nodeName.isPlain())
     {
-        for (int counter = 0; counter < adjacencyMatrix[rows][cols].size(); ++counter)
-        {
-            try
-            {
-                nodes[listOfNodes[rows]]->add(adjacencyMatrix[rows][cols].back(), nodes[listOfNodes[cols]]);
-            }
-            catch (std::overflow_error error)
-            {
-                std::cout << error.what();
-            }
-        }
+        nameIndices[nodeName.toString()] = index;
     }
+    return index;
 }
 
-void DetermAutomaton::copyFinals(const DetermAutomaton &other)
+int DetermAutomaton::findNode(const std::string &nodeName) const
 {
-    for (int i = 0; i < other.finalNodes.size(); ++i)
+    auto found = nameIndices.find(nodeName);
+    if (found != nameIndices.end())
     {
-        finalNodes.push_back(nodes[other.finalNodes[i]->getNodeName()]);
+        return found->second;
     }
-}
-
-void DetermAutomaton::buildAdjencyMatrix(std::string **adjacencyMatrix, std::vector<std::string> listOfNodes,
-                                         std::unordered_map<std::string, int> listOfIndices, bool isNew) const
-{
-    int size = nodes.size();
-    for (int rows = 0; rows < size; ++rows)
+    for (; indexedNodesCount < names.size(); ++indexedNodesCount)
     {
-        Node *s = (this->nodes.lower_bound(listOfNodes[rows]))->second;
-        std::vector<std::pair<const char, const DetermAutomaton::Node *>> nextStates;
-        if (!isNew)
+        if (!names[indexedNodesCount].isPlain())
         {
-            nextStates = (this->nodes.at(listOfNodes[rows]))->getNext();
-        }
-        else
-        {
-            nextStates = s->getNext();
-        }
-
-        for (int k = 0; k < nextStates.size(); ++k)
-        {
-
-            adjacencyMatrix[rows][listOfIndices[nextStates[k].second->getNodeName()]].push_back(nextStates[k].first);
+            nameIndices.emplace(names[indexedNodesCount].toString(), indexedNodesCount);
         }
     }
+    found = nameIndices.find(nodeName);
+    return found == nameIndices.end() ? NO_NODE : found->second;
 }
 
-DetermAutomaton::DetermAutomaton() : first{nullptr} {}
+DetermAutomaton::DetermAutomaton() : first{NO_NODE} {}
 
-DetermAutomaton::~DetermAutomaton()
-{
-    deleteNodes();
-}
+DetermAutomaton::~DetermAutomaton() = default;
 
 DetermAutomaton::DetermAutomaton(const DetermAutomaton &other)
 {
@@ -226,6 +148,23 @@ DetermAutomaton &DetermAutomaton::operator=(const DetermAutomaton &other)
     return *this;
 }
 
+// the autos are kept in vectors, which copy their elements when they grow if the moves may throw
+static_assert(std::is_nothrow_move_constructible_v<DetermAutomaton> && std::is_nothrow_move_assignable_v<DetermAutomaton>);
+
+DetermAutomaton::DetermAutomaton(DetermAutomaton &&other) noexcept
+{
+    move(other);
+}
+
+DetermAutomaton &DetermAutomaton::operator=(DetermAutomaton &&other) noexcept
+{
+    if (this != &other)
+    {
+        move(other);
+    }
+    return *this;
+}
+
 void DetermAutomaton::addFirstNode(const std::string &nodeName)
 {
     if (!isEmpty())
@@ -233,8 +172,7 @@ void DetermAutomaton::addFirstNode(const std::string &nodeName)
         throw std::invalid_argument("There is already a first element!");
     }
 
-    this->first = new Node(nodeName);
-    nodes[nodeName] = first;
+    first = addNode(nodeName);
 }
 
 void DetermAutomaton::addTransition(const std::string &nodeStartName, const char &transitionChar, const std::string &nodeEndName)
@@ -244,36 +182,40 @@ void DetermAutomaton::addTransition(const std::string &nodeStartName, const char
         throw std::bad_alloc();
     }
 
-    if (nodes.count(nodeStartName) == 0)
+    int startNode = findNode(nodeStartName);
+    if (startNode == NO_NODE)
     {
         throw std::invalid_argument("No starting node");
     }
-    if (nodes.count(nodeEndName) == 0)
+    int endNode = findNode(nodeEndName);
+    if (endNode == NO_NODE)
     {
-        nodes[nodeEndName] = new Node(nodeEndName);
+        endNode = addNode(nodeEndName);
     }
-    try
+    int existingNode = nodes[startNode].add(transitionChar, endNode);
+    if (existingNode == endNode)
     {
-        nodes[nodeStartName]->add(transitionChar, nodes[nodeEndName]);
+        std::cout << "There is already the same transition.\n";
     }
-    catch (std::overflow_error warning)
+    else if (existingNode != NO_NODE)
     {
-        std::cout << warning.what();
+        std::cout << "Nondeterministic actions.\n";
     }
 }
 
 void DetermAutomaton::addFinals(const std::string &nodeName)
 {
-    if (nodes.count(nodeName) == 0)
+    int node = findNode(nodeName);
+    if (node == NO_NODE)
     {
         throw std::invalid_argument("No such final state");
     }
-    finalNodes.push_back(nodes[nodeName]);
+    addFinalNode(node);
 }
 
 bool DetermAutomaton::isEmpty() const
 {
-    return !first;
+    return first == NO_NODE;
 }
 
 bool DetermAutomaton::isWordFromAuto(const std::string &transitionWord)
@@ -285,7 +227,7 @@ bool DetermAutomaton::isWordFromAuto(const std::string &transitionWord)
         it.transition(transitionWord[i++], *this);
     }
 
-    return (i == transitionWord.size() && it.isMember(this->end()));
+    return (i == transitionWord.size() && it.isFinal());
 }
 
 typename DetermAutomaton::AutoIterator DetermAutomaton::begin() const
@@ -294,7 +236,7 @@ typename DetermAutomaton::AutoIterator DetermAutomaton::begin() const
     {
         throw std::out_of_range("Empty automaton");
     }
-    return AutoIterator(first);
+    return AutoIterator(this, first);
 }
 
 typename std::vector<DetermAutomaton::AutoIterator> DetermAutomaton::end() const
@@ -302,14 +244,14 @@ typename std::vector<DetermAutomaton::AutoIterator> DetermAutomaton::end() const
     std::vector<DetermAutomaton::AutoIterator> finalStates;
     for (int i = 0; i < finalNodes.size(); ++i)
     {
-        finalStates.push_back(DetermAutomaton::AutoIterator(finalNodes[i]));
+        finalStates.push_back(DetermAutomaton::AutoIterator(this, finalNodes[i]));
     }
     return finalStates;
 }
 
 typename DetermAutomaton::AutoIterator DetermAutomaton::out() const
 {
-    return AutoIterator(nullptr);
+    return AutoIterator(this);
 }
 
 bool DetermAutomaton::AutoIterator::isMember(const std::vector<AutoIterator> &iterators)
@@ -324,23 +266,27 @@ bool DetermAutomaton::AutoIterator::isMember(const std::vector<AutoIterator> &it
     return false;
 }
 
-const DetermAutomaton::Node *DetermAutomaton::AutoIterator::getCurrent() { return current; }
+bool DetermAutomaton::AutoIterator::isFinal() const
+{
+    return current != NO_NODE && automaton->finals[current];
+}
+
+int DetermAutomaton::AutoIterator::getCurrent() { return current; }
 
 std::istream &DetermAutomaton::getWordFromStream(std::istream &in) const
 {
     DetermAutomaton::AutoIterator it = this->begin();
     DetermAutomaton::AutoIterator out = this->out();
-    std::vector<AutoIterator> finals = this->end();
     char symbol;
     in >> symbol;
     it.transition(symbol, *this);
-    while (in && it != out && (!it.isMember(finals)))
+    while (in && it != out && !it.isFinal())
     {
         in >> symbol;
         it.transition(symbol, *this);
     }
 
-    if (it.isMember(finals))
+    if (it.isFinal())
     {
         std::cout << "The word is from the automaton. ";
     }
@@ -360,294 +306,394 @@ DetermAutomaton DetermAutomaton::complementation()
 
 void DetermAutomaton::swapFinalStates()
 {
-    std::vector<Node *> newFinalNodes;
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
+    finals.flip();
+    finalNodes.clear();
+    for (int i = 0; i < nodes.size(); ++i)
     {
-        if (!isFinalState(i->second))
+        if (finals[i])
         {
-            newFinalNodes.push_back(i->second);
+            finalNodes.push_back(i);
         }
     }
-    finalNodes.clear();
-    finalNodes = newFinalNodes;
 }
 
-bool DetermAutomaton::isFinalState(const DetermAutomaton::Node *myNode) const
+bool DetermAutomaton::isFinalState(int myNode) const
 {
-    for (int i = 0; i < finalNodes.size(); ++i)
+    return finals[myNode];
+}
+
+void DetermAutomaton::addFinalNode(int myNode)
+{
+    if (!finals[myNode])
     {
-        if (myNode == finalNodes[i])
-        {
-            return true;
-        }
+        finals[myNode] = true;
+        finalNodes.push_back(myNode);
     }
-    return false;
 }
 
 void DetermAutomaton::visualize(std::ostream &out) const
 {
     out << "Automat\n";
-    out << "First: " << first->getNodeName() << "\n";
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
+    out << "First: " << names[first].toString() << "\n";
+    for (int i = 0; i < nodes.size(); ++i)
     {
-        out << i->second->getNodeName() << " ";
-        std::vector<std::pair<const char, const DetermAutomaton::Node *>> next = i->second->getNext();
+        out << names[i].toString() << " ";
+        const std::vector<std::pair<char, int>> &next = nodes[i].getNext();
         for (int k = 0; k < next.size(); ++k)
         {
-            out << "(" << next[k].first << ", " << next[k].second->getNodeName() << ") ";
+            out << "(" << next[k].first << ", " << names[next[k].second].toString() << ") ";
         }
         out << " \n";
     }
     out << "Finals: ";
     for (int i = 0; i < finalNodes.size(); ++i)
     {
-        out << finalNodes[i]->getNodeName() << " ";
+        out << names[finalNodes[i]].toString() << " ";
     }
     out << std::endl;
 }
 
 DetermAutomaton DetermAutomaton::intersection(const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto)
 {
-    DetermAutomaton myAuto(intersectionUnionHelper(firstAuto, secondAuto));
-
-    for (int i = 0; i < firstAuto.finalNodes.size(); ++i)
-    {
-        for (int k = 0; k < secondAuto.finalNodes.size(); ++k)
-        {
-            std::string name = DetermAutomaton::constructPair(firstAuto.finalNodes[i], secondAuto.finalNodes[k]);
-            myAuto.finalNodes.push_back(myAuto.nodes[name]);
-        }
-    }
-    return myAuto;
+    return intersectionUnionHelper(firstAuto, secondAuto, false);
 }
 
-std::string DetermAutomaton::constructPair(const DetermAutomaton::Node *firstNode, const DetermAutomaton::Node *secondNode)
+DetermAutomaton DetermAutomaton::unions(const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto)
 {
-    return "(" + firstNode->getNodeName() + "," + secondNode->getNodeName() + ")";
+    return intersectionUnionHelper(firstAuto, secondAuto, true);
 }
 
-void DetermAutomaton::buildAdjencyMatrixIntersection(std::string **adjencyMatrix, const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto)
+std::size_t DetermAutomaton::PairHash::operator()(const std::pair<int, int> &myPair) const
 {
-    int sizeFirstAutoNodes = firstAuto.nodes.size();
-    int sizeSecondAutoNodes = secondAuto.nodes.size();
-    std::string **matrixFirstAuto, **matrixSecondAuto;
-    matrixFirstAuto = new std::string *[sizeFirstAutoNodes];
-    matrixSecondAuto = new std::string *[sizeSecondAutoNodes];
-
-    std::vector<std::string> listOfNodes1;
-    std::unordered_map<std::string, int> listOfIndices1;
-    std::vector<std::string> listOfNodes2;
-    std::unordered_map<std::string, int> listOfIndices2;
+    return std::hash<int>()(myPair.first) * 31 + std::hash<int>()(myPair.second);
+}
 
-    int counter = 0;
-    for (auto i = firstAuto.nodes.begin(); i != firstAuto.nodes.end(); i++)
-    {
-        matrixFirstAuto[counter] = new std::string[sizeFirstAutoNodes];
-        listOfNodes1.push_back(i->second->getNodeName());
-        listOfIndices1[i->second->getNodeName()] = counter++;
-    }
-    counter = 0;
-    for (auto i = secondAuto.nodes.begin(); i != secondAuto.nodes.end(); i++)
+DetermAutomaton DetermAutomaton::intersectionUnionHelper(const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto, bool isUnion)
+{
+    if (firstAuto.isEmpty() || secondAuto.isEmpty())
     {
-        matrixSecondAuto[counter] = new std::string[sizeSecondAutoNodes];
-        listOfNodes2.push_back(i->second->getNodeName());
-        listOfIndices2[i->second->getNodeName()] = counter++;
+        throw std::out_of_range("Empty automaton");
     }
+    std::vector<int> listOfNodes1, listOfNodes2;
+    std::vector<int> listOfIndices1, listOfIndices2;
+    firstAuto.indexReachableNodes(listOfNodes1, listOfIndices1);
+    secondAuto.indexReachableNodes(listOfNodes2, listOfIndices2);
+    ByteClasses byteClasses;
+    firstAuto.addToByteClasses(byteClasses, listOfNodes1, listOfIndices1, 0);
+    secondAuto.addToByteClasses(byteClasses, listOfNodes2, listOfIndices2, listOfNodes1.size());
+    byteClasses.build();
+
+    DetermAutomaton myAuto;
+    std::unordered_map<std::pair<int, int>, int, PairHash> productNodes;
+    std::vector<std::pair<int, int>> queue;
+    std::pair<int, int> firstPair(firstAuto.first, secondAuto.first);
 
-    firstAuto.buildAdjencyMatrix(matrixFirstAuto, listOfNodes1, listOfIndices1, false);
-    secondAuto.buildAdjencyMatrix(matrixSecondAuto, listOfNodes2, listOfIndices2, false);
+    myAuto.first = myAuto.addPairNode(firstAuto, secondAuto, firstPair, isUnion);
+    productNodes[firstPair] = myAuto.first;
+    queue.push_back(firstPair);
 
-    for (int rowFirst = 0; rowFirst < sizeFirstAutoNodes; ++rowFirst)
+    for (int i = 0; i < queue.size(); ++i)
     {
-        for (int rowSecond = 0; rowSecond < sizeSecondAutoNodes; ++rowSecond)
+        std::pair<int, int> current = queue[i];
+        int currentNode = productNodes[current];
+        for (int k = 0; k < byteClasses.getClassesCount(); ++k)
         {
-            buildAdjencyMatrixIntersectionHelper(adjencyMatrix, firstAuto, secondAuto,
-                                                 sizeFirstAutoNodes, sizeSecondAutoNodes, listOfNodes1, listOfNodes2,
-                                                 rowFirst, rowSecond);
+            const std::string &chars = byteClasses.getChars(k);
+            std::pair<int, int> next(current.first != NO_NODE ? firstAuto.nodes[current.first].hasSymbolTransition(chars[0]) : NO_NODE,
+                                     current.second != NO_NODE ? secondAuto.nodes[current.second].hasSymbolTransition(chars[0]) : NO_NODE);
+            if (isUnion ? (next.first == NO_NODE && next.second == NO_NODE) : (next.first == NO_NODE || next.second == NO_NODE))
+            {
+                continue;
+            }
+            if (productNodes.count(next) == 0)
+            {
+                productNodes[next] = myAuto.addPairNode(firstAuto, secondAuto, next, isUnion);
+                queue.push_back(next);
+            }
+            for (int c = 0; c < chars.size(); ++c)
+            {
+                myAuto.nodes[currentNode].append(chars[c], productNodes[next]);
+            }
         }
     }
+    return myAuto;
+}
 
-    for (int i = 0; i < sizeFirstAutoNodes; ++i)
-    {
-        delete matrixFirstAuto[i];
-    }
-    for (int i = 0; i < sizeSecondAutoNodes; ++i)
+int DetermAutomaton::addPairNode(const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto,
+                                 const std::pair<int, int> &myPair, bool isUnion)
+{
+    int node = addNode(StateName::pair(myPair.first != NO_NODE ? firstAuto.names[myPair.first] : StateName(),
+                                       myPair.second != NO_NODE ? secondAuto.names[myPair.second] : StateName()));
+
+    bool firstIsFinal = myPair.first != NO_NODE && firstAuto.finals[myPair.first];
+    bool secondIsFinal = myPair.second != NO_NODE && secondAuto.finals[myPair.second];
+    if (isUnion ? (firstIsFinal || secondIsFinal) : (firstIsFinal && secondIsFinal))
     {
-        delete matrixSecondAuto[i];
+        addFinalNode(node);
     }
-    delete matrixFirstAuto;
-    delete matrixSecondAuto;
+    return node;
 }
 
-void DetermAutomaton::buildAdjencyMatrixIntersectionHelper(std::string **adjencyMatrix, const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto,
-                                                           const int &sizeFirstAutoNodes, const int &sizeSecondAutoNodes, const std::vector<std::string> &listOfNodes1, const std::vector<std::string> &listOfNodes2,
-                                                           const int &rowFirst, const int &rowSecond)
+bool DetermAutomaton::isUnique(const std::string &uniqueName) const
 {
-    for (int colFirst = 0; colFirst < sizeFirstAutoNodes; ++colFirst)
-    {
-        for (int colSecond = 0; colSecond < sizeSecondAutoNodes; ++colSecond)
-        {
-            std::string transitionFirst = firstAuto.reach(listOfNodes1[rowFirst], listOfNodes1[colFirst]);
-            std::string transitionSecond = secondAuto.reach(listOfNodes2[rowSecond], listOfNodes2[colSecond]);
-            DetermAutomaton::pushBackEqualChars(adjencyMatrix[rowFirst * sizeSecondAutoNodes + rowSecond]
-                                                             [colFirst * sizeSecondAutoNodes + colSecond],
-                                                transitionFirst, transitionSecond);
-        }
-    }
+    return findNode(uniqueName) == NO_NODE;
+}
+
+std::vector<std::string> DetermAutomaton::hasPathFromTo(int startingNode, int goalNode) const
+{
+    return hasPathFromToHelper(startingNode, goalNode, 0);
 }
 
-std::string DetermAutomaton::reach(const std::string &index1, const std::string &index2) const
+std::vector<std::string> DetermAutomaton::hasPathFromToHelper(int startingNode, int goalNode, int counter) const
 {
-    std::string transitionChars;
-    std::vector<std::pair<const char, const DetermAutomaton::Node *>> nexts = nodes.at(index1)->getNext();
+    if (startingNode == goalNode)
+    {
+        return std::vector<std::string>(1, "");
+    }
+    const std::vector<std::pair<char, int>> &nexts = nodes[startingNode].getNext();
+    if (counter > nodes.size() || nexts.empty())
+    {
+        return std::vector<std::string>();
+    }
+
+    std::vector<std::string> newPaths;
     for (int i = 0; i < nexts.size(); ++i)
     {
-        if (nodes.at(index2)->getNodeName().compare(nexts[i].second->getNodeName()) == 0)
+        std::vector<std::string> currentPath = hasPathFromToHelper(nexts[i].second, goalNode, counter + 1);
+        for (int k = 0; k < currentPath.size(); ++k)
         {
-            transitionChars.push_back(nexts[i].first);
+            newPaths.push_back(nexts[i].first + currentPath[k]);
         }
     }
-    return transitionChars;
+    return newPaths;
 }
 
-void DetermAutomaton::pushBackEqualChars(std::string &destination, const std::string &str1, const std::string &str2)
+void DetermAutomaton::indexReachableNodes(std::vector<int> &listOfNodes, std::vector<int> &listOfIndices) const
 {
-    for (int i = 0; i < str1.size(); ++i)
+    listOfIndices.assign(nodes.size(), NO_NODE);
+    listOfNodes.push_back(first);
+    listOfIndices[first] = 0;
+    for (int i = 0; i < listOfNodes.size(); ++i)
     {
-        for (int k = 0; k < str2.size(); ++k)
+        const std::vector<std::pair<char, int>> &nexts = nodes[listOfNodes[i]].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
         {
-            if (str1[i] == str2[k])
+            if (listOfIndices[nexts[k].second] == NO_NODE)
             {
-                destination.push_back(str1[i]);
+                listOfIndices[nexts[k].second] = listOfNodes.size();
+                listOfNodes.push_back(nexts[k].second);
             }
         }
     }
 }
 
-void DetermAutomaton::addAllTransitionChars(Node *startNode, std::string &transitionChars, const Node *destinationNode)
+void DetermAutomaton::addToByteClasses(ByteClasses &byteClasses, const std::vector<int> &listOfNodes,
+                                       const std::vector<int> &listOfIndices, int offset) const
 {
-    for (int i = 0; i < transitionChars.size(); ++i)
+    for (int i = 0; i < listOfNodes.size(); ++i)
     {
-        try
+        const std::vector<std::pair<char, int>> &nexts = nodes[listOfNodes[i]].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
         {
-            startNode->add(transitionChars[i], destinationNode);
-        }
-        catch (std::overflow_error error)
-        {
-            std::cout << error.what();
+            byteClasses.add(offset + i, nexts[k].first, offset + listOfIndices[nexts[k].second]);
         }
     }
 }
 
-DetermAutomaton DetermAutomaton::unions(const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto)
+DetermAutomaton DetermAutomaton::minimize() const
 {
-    DetermAutomaton myAuto(intersectionUnionHelper(firstAuto, secondAuto));
+    if (isEmpty())
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    std::vector<int> listOfNodes;
+    std::vector<int> listOfIndices;
+    indexReachableNodes(listOfNodes, listOfIndices);
+    ByteClasses byteClasses;
+    addToByteClasses(byteClasses, listOfNodes, listOfIndices, 0);
+    byteClasses.build();
+
+    int symbolsCount = byteClasses.getClassesCount();
+    int deadState = listOfNodes.size();
 
-    for (int i = 0; i < firstAuto.finalNodes.size(); ++i)
+    std::vector<std::vector<int>> transitionTable(deadState + 1, std::vector<int>(symbolsCount, deadState));
+    std::vector<bool> finalStates(deadState + 1, false);
+    for (int i = 0; i < deadState; ++i)
     {
-        for (auto k = secondAuto.nodes.begin(); k != secondAuto.nodes.end(); k++)
+        const std::vector<std::pair<char, int>> &nexts = nodes[listOfNodes[i]].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
         {
-            std::string name = DetermAutomaton::constructPair(firstAuto.finalNodes[i], k->second);
-            myAuto.finalNodes.push_back(myAuto.nodes[name]);
+            transitionTable[i][byteClasses.getClass(nexts[k].first)] = listOfIndices[nexts[k].second];
         }
+        finalStates[i] = isFinalState(listOfNodes[i]);
     }
-    for (auto i = firstAuto.nodes.begin(); i != firstAuto.nodes.end(); i++)
+
+    std::vector<int> blocks = refinePartition(transitionTable, finalStates, symbolsCount);
+    int deadBlock = blocks[deadState];
+
+    DetermAutomaton myAuto;
+    std::vector<int> blockNodes(deadState + 1, NO_NODE);
+    std::vector<int> representatives;
+    for (int i = 0; i < deadState; ++i)
     {
-        if (!firstAuto.isFinalState(i->second))
+        if (blockNodes[blocks[i]] != NO_NODE || (blocks[i] == deadBlock && i != 0))
+        {
+            continue;
+        }
+        int node = myAuto.addNode(names[listOfNodes[i]]);
+        blockNodes[blocks[i]] = node;
+        representatives.push_back(i);
+        if (finalStates[i])
         {
-            for (int k = 0; k < secondAuto.finalNodes.size(); ++k)
+            myAuto.addFinalNode(node);
+        }
+    }
+    myAuto.first = blockNodes[blocks[0]];
+
+    for (int i = 0; i < representatives.size(); ++i)
+    {
+        int state = representatives[i];
+        for (int k = 0; k < symbolsCount; ++k)
+        {
+            int nextBlock = blocks[transitionTable[state][k]];
+            if (nextBlock == deadBlock)
             {
-                std::string name = DetermAutomaton::constructPair(i->second, secondAuto.finalNodes[k]);
-                myAuto.finalNodes.push_back(myAuto.nodes[name]);
+                continue;
+            }
+            const std::string &chars = byteClasses.getChars(k);
+            for (int c = 0; c < chars.size(); ++c)
+            {
+                myAuto.nodes[blockNodes[blocks[state]]].append(chars[c], blockNodes[nextBlock]);
             }
         }
     }
-
     return myAuto;
 }
 
-DetermAutomaton DetermAutomaton::intersectionUnionHelper(const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto)
+std::vector<int> DetermAutomaton::refinePartition(const std::vector<std::vector<int>> &transitionTable,
+                                                  const std::vector<bool> &finalStates, int symbolsCount)
 {
-
-    DetermAutomaton myAuto;
-    std::vector<std::string> listOfNodes;
-    for (auto firstI = firstAuto.nodes.begin(); firstI != firstAuto.nodes.end(); firstI++)
+    int size = transitionTable.size();
+    std::vector<std::vector<std::vector<int>>> inverse(symbolsCount, std::vector<std::vector<int>>(size));
+    for (int state = 0; state < size; ++state)
     {
-        for (auto secondI = secondAuto.nodes.begin(); secondI != secondAuto.nodes.end(); secondI++)
+        for (int k = 0; k < symbolsCount; ++k)
         {
-            std::string name = DetermAutomaton::constructPair(firstI->second, secondI->second);
-            Node *node = new Node(name);
-            myAuto.nodes[name] = node;
-            listOfNodes.push_back(name);
+            inverse[k][transitionTable[state][k]].push_back(state);
         }
     }
-    myAuto.first = myAuto.nodes[DetermAutomaton::constructPair(firstAuto.first, secondAuto.first)];
-
-    int matrixSize = secondAuto.nodes.size() * firstAuto.nodes.size();
-    std::string **adjencyMatrix = new std::string *[matrixSize];
 
-    for (int i = 0; i < matrixSize; ++i)
+    // the blocks are kept as ranges [blockBegin, blockEnd) of the elements vector
+    std::vector<int> elements, location(size), blockOf(size), blockBegin, blockEnd, marked;
+    for (int state = 0; state < size; ++state)
     {
-        adjencyMatrix[i] = new std::string[matrixSize];
+        if (finalStates[state])
+        {
+            elements.push_back(state);
+        }
     }
-
-    myAuto.buildAdjencyMatrixIntersection(adjencyMatrix, firstAuto, secondAuto);
-
-    for (int row = 0; row < matrixSize; ++row)
+    int finalsCount = elements.size();
+    for (int state = 0; state < size; ++state)
     {
-        for (int col = 0; col < matrixSize; ++col)
+        if (!finalStates[state])
         {
-            addAllTransitionChars(myAuto.nodes[listOfNodes[row]], adjencyMatrix[row][col], myAuto.nodes[listOfNodes[col]]);
+            elements.push_back(state);
         }
     }
-
-    for (int i = 0; i < matrixSize; ++i)
+    if (finalsCount > 0)
     {
-        delete adjencyMatrix[i];
+        blockBegin.push_back(0);
+        blockEnd.push_back(finalsCount);
     }
-    delete adjencyMatrix;
-    return myAuto;
-}
-
-bool DetermAutomaton::isUnique(const std::string &uniqueName) const
-{
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
+    if (finalsCount < size)
     {
-        if (uniqueName.compare(i->second->getNodeName()) == 0)
+        blockBegin.push_back(finalsCount);
+        blockEnd.push_back(size);
+    }
+    for (int block = 0; block < blockBegin.size(); ++block)
+    {
+        marked.push_back(0);
+        for (int i = blockBegin[block]; i < blockEnd[block]; ++i)
         {
-            return false;
+            location[elements[i]] = i;
+            blockOf[elements[i]] = block;
         }
     }
-    return true;
-}
 
-std::vector<std::string> DetermAutomaton::hasPathFromTo(const Node *startingNode, const Node *goalNode)
-{
-    return hasPathFromToHelper(startingNode, goalNode, 0);
-}
-
-std::vector<std::string> DetermAutomaton::hasPathFromToHelper(const Node *startingNode, const Node *goalNode, int counter)
-{
-    if (startingNode == goalNode)
+    std::vector<std::pair<int, int>> splitters;
+    std::vector<std::vector<bool>> isSplitter;
+    for (int block = 0; block < blockBegin.size(); ++block)
     {
-        return std::vector<std::string>(1, "");
+        isSplitter.push_back(std::vector<bool>(symbolsCount, false));
     }
-    if (counter > nodes.size() || startingNode->getNext().empty())
+    int smallest = (blockBegin.size() == 2 && size - finalsCount < finalsCount) ? 1 : 0;
+    for (int k = 0; k < symbolsCount; ++k)
     {
-        return std::vector<std::string>();
+        splitters.push_back(std::pair(smallest, k));
+        isSplitter[smallest][k] = true;
     }
 
-    std::vector<std::pair<const char, const DetermAutomaton::Node *>> nexts = startingNode->getNext();
-    std::vector<std::string> newPaths;
-    for (int i = 0; i < nexts.size(); ++i)
+    while (!splitters.empty())
     {
-        std::vector<std::string> currentPath = hasPathFromToHelper(nexts[i].second, goalNode, counter + 1);
-        for (int k = 0; k < currentPath.size(); ++k)
+        std::pair<int, int> splitter = splitters.back();
+        splitters.pop_back();
+        isSplitter[splitter.first][splitter.second] = false;
+
+        std::vector<int> splitterStates(elements.begin() + blockBegin[splitter.first],
+                                        elements.begin() + blockEnd[splitter.first]);
+        std::vector<int> touchedBlocks;
+        for (int i = 0; i < splitterStates.size(); ++i)
         {
-            newPaths.push_back(nexts[i].first + currentPath[k]);
+            const std::vector<int> &previous = inverse[splitter.second][splitterStates[i]];
+            for (int k = 0; k < previous.size(); ++k)
+            {
+                int state = previous[k];
+                int block = blockOf[state];
+                int position = blockBegin[block] + marked[block];
+                if (location[state] < position)
+                {
+                    continue;
+                }
+                std::swap(elements[location[state]], elements[position]);
+                location[elements[location[state]]] = location[state];
+                location[state] = position;
+                if (marked[block]++ == 0)
+                {
+                    touchedBlocks.push_back(block);
+                }
+            }
+        }
+
+        for (int i = 0; i < touchedBlocks.size(); ++i)
+        {
+            int block = touchedBlocks[i];
+            int markedCount = marked[block];
+            marked[block] = 0;
+            if (markedCount == blockEnd[block] - blockBegin[block])
+            {
+                continue;
+            }
+            int newBlock = blockBegin.size();
+            blockBegin.push_back(blockBegin[block]);
+            blockEnd.push_back(blockBegin[block] + markedCount);
+            marked.push_back(0);
+            isSplitter.push_back(std::vector<bool>(symbolsCount, false));
+            blockBegin[block] += markedCount;
+            for (int k = blockBegin[newBlock]; k < blockEnd[newBlock]; ++k)
+            {
+                blockOf[elements[k]] = newBlock;
+            }
+
+            bool newIsSmaller = markedCount <= blockEnd[block] - blockBegin[block];
+            for (int k = 0; k < symbolsCount; ++k)
+            {
+                int added = (isSplitter[block][k] || newIsSmaller) ? newBlock : block;
+                splitters.push_back(std::pair(added, k));
+                isSplitter[added][k] = true;
+            }
         }
     }
-    return newPaths;
+    return blockOf;
 }
 
 std::ostream &operator<<(std::ostream &out, const DetermAutomaton &myAuto)
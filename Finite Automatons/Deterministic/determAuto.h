@@ -6,93 +6,97 @@
 #include <unordered_map>
 #include <utility>
 #include <fstream>
+#include <string>
+#include "byteClasses.h"
+#include "stateName.h"
 
 ///class DetermAutomaton allows the user to work with a deterministic automaton
 class DetermAutomaton
 { 
+    ///marks a missing node
+    static constexpr int NO_NODE = -1;
+
     struct Node
     {
     private:
-        std::string nodeName;
-        std::vector<std::pair<const char, const Node *>> next;
-        void copy(const Node &);
+        std::vector<std::pair<char, int>> next;
 
     public:
-        Node(const std::string &name) : nodeName{name} {}
-
-        ~Node() = default;
-
-        Node &operator=(const Node &);
-
-        Node(const Node &);
-
-        ///adds a transition from this node to another node
-        void add(const char &, const Node *);
+        ///adds a transition from this node to the node with the index if there is no transition with the char,
+        ///returns the node to which there was already a transition or NO_NODE
+        int add(const char &, int);
 
-        std::string getNodeName() const;
+        ///adds a transition without checking whether there is already a transition with the char
+        void append(const char &, int);
 
-        ///returns the node to which there is a transition from this node with the char
-        const Node *hasSymbolTransition(const char &) const;
+        ///returns the index of the node to which there is a transition from this node with the char or NO_NODE
+        int hasSymbolTransition(const char &) const;
 
         ///returns the list of transitions from this node
-        std::vector<std::pair<const char, const Node *>> getNext() const;
-
-        ///changes the name of the node by appending a string to the end
-        void pushBackToName(const char &);
+        const std::vector<std::pair<char, int>> &getNext() const;
     };
 
-    Node *first;
-    std::vector<Node *> finalNodes;
-    std::map<std::string, Node *> nodes;
-
-    void deleteNodes();
+    ///the nodes are numbered from 0 to nodes.size() - 1 and their transitions hold the indices of the next nodes
+    int first;
+    std::vector<Node> nodes;
+    ///marks the final nodes by their indices, finalNodes lists them in the order they were added to be printed
+    std::vector<bool> finals;
+    std::vector<int> finalNodes;
+    ///the names are only used to build the auto node by node and to print it, the plain names are indexed when they are added
+    ///and the names of products and renamed nodes are printed and indexed only when a name is not found
+    std::vector<StateName> names;
+    mutable std::unordered_map<std::string, int> nameIndices;
+    ///the nodes before this index have their names in nameIndices
+    mutable int indexedNodesCount = 0;
 
     void copy(const DetermAutomaton &);
 
-    void copyTransitions(const DetermAutomaton &);
+    ///takes the nodes of the other auto and leaves it empty
+    void move(DetermAutomaton &) noexcept;
 
-    void copyFinals(const DetermAutomaton &other);
+    ///adds a node without transitions and returns its index
+    int addNode(const StateName &);
 
-    bool isFinalState(const Node *) const;
+    ///returns the index of the node with the name or NO_NODE
+    int findNode(const std::string &) const;
 
-    ///builds an adjency matrix of the nodes of the automaton
-    void buildAdjencyMatrix(std::string **, std::vector<std::string> listOfNodes,
-                            std::unordered_map<std::string, int> listOfIndices, bool isNew) const;
+    bool isFinalState(int) const;
 
-    ///returns a string constructed with the names of both nodes
-    static std::string constructPair(const DetermAutomaton::Node *, const DetermAutomaton::Node *);
+    ///marks the node as final if it is not already
+    void addFinalNode(int);
 
-    static void buildAdjencyMatrixIntersection(std::string **, const DetermAutomaton &, const DetermAutomaton &);
-
-    static void buildAdjencyMatrixIntersectionHelper(std::string **adjencyMatrix,
-                                                     const DetermAutomaton &firstAuto, const DetermAutomaton &secondAuto,
-                                                     const int &sizeFirstAutoNodes, const int &sizeSecondAutoNodes,
-                                                     const std::vector<std::string> &listOfNodes1, const std::vector<std::string> &listOfNodes2,
-                                                     const int &rowFirst, const int &rowSecond);
+    ///hashes a pair of nodes of the product of two autos
+    struct PairHash
+    {
+        std::size_t operator()(const std::pair<int, int> &) const;
+    };
 
-    static DetermAutomaton intersectionUnionHelper(const DetermAutomaton &, const DetermAutomaton &);
+    ///builds the product of the two autos from the pair of first nodes, NO_NODE stands for a missing transition
+    static DetermAutomaton intersectionUnionHelper(const DetermAutomaton &, const DetermAutomaton &, bool isUnion);
 
-    std::vector<std::string> hasPathFromToHelper(const Node *, const Node *, int counter);
+    ///adds a node for a pair of nodes of the product and marks it as final if needed
+    int addPairNode(const DetermAutomaton &, const DetermAutomaton &, const std::pair<int, int> &, bool isUnion);
 
-    void copyTransitionsHelper(const int &rows, const int &size, std::string **adjacencyMatrix,
-                               const std::vector<std::string> &listOfNodes, const DetermAutomaton &other);
+    std::vector<std::string> hasPathFromToHelper(int, int, int counter) const;
 
-    ///builds a vector of chars with the chars which repeats in the const vectors
-    static void pushBackEqualChars(std::string &, const std::string &, const std::string &);
+    ///numbers the nodes reachable from the first node in breadth-first order, listOfIndices is NO_NODE for the other nodes
+    void indexReachableNodes(std::vector<int> &listOfNodes, std::vector<int> &listOfIndices) const;
 
-    ///builds a vector of chars with the chars which repeats in the const vectors
-    static void addAllTransitionChars(Node *startNode, std::string &chars, const Node *destination);
+    ///adds the transitions of the numbered nodes to the byte classes, the indices are shifted by offset
+    void addToByteClasses(ByteClasses &, const std::vector<int> &listOfNodes, const std::vector<int> &listOfIndices, int offset) const;
 
-    ///returns the transition chars from node with index1 to node with index2
-    std::string reach(const std::string &index1, const std::string &index2) const;
+    ///splits the states to blocks of equivalent states with Hopcroft's algorithm
+    static std::vector<int> refinePartition(const std::vector<std::vector<int>> &transitionTable,
+                                            const std::vector<bool> &finalStates, int symbolsCount);
 
 public:
     class AutoIterator
     {
-        const DetermAutomaton::Node *current;
+        const DetermAutomaton *automaton;
+        int current;
 
     public:
-        AutoIterator(const DetermAutomaton::Node *node = nullptr) : current{node} {}
+        AutoIterator(const DetermAutomaton *_automaton = nullptr, int node = NO_NODE) : automaton{_automaton}, current{node} {}
 
         ///checks whether the current nodes of both iterators are not equal
         bool operator!=(const AutoIterator &other);
@@ -109,7 +113,11 @@ public:
         ///checks whether the iterator is from the vector of iterators
         bool isMember(const std::vector<AutoIterator> &);
 
-        const DetermAutomaton::Node *getCurrent();
+        ///checks whether the current node is final
+        bool isFinal() const;
+
+        ///returns the index of the current node or NO_NODE
+        int getCurrent();
     };
 
     DetermAutomaton();
@@ -120,6 +128,10 @@ public:
 
     DetermAutomaton &operator=(const DetermAutomaton &);
 
+    DetermAutomaton(DetermAutomaton &&) noexcept;
+
+    DetermAutomaton &operator=(DetermAutomaton &&) noexcept;
+
     void addFirstNode(const std::string &);
 
     void addTransition(const std::string &, const char &, const std::string &);
@@ -154,16 +166,27 @@ public:
     ///prints information about the auto
     void visualize(std::ostream &) const;
 
+    ///returns the minimal auto with the same language
+    DetermAutomaton minimize() const;
+
     ///returns an auto the language of which is an intersection of the languages of the two autos
     static DetermAutomaton intersection(const DetermAutomaton &, const DetermAutomaton &);
 
     ///returns an auto the language of which is an union of the languages of the two autos
     static DetermAutomaton unions(const DetermAutomaton &, const DetermAutomaton &);
 
-    ///returns the path from the first to the second node
-    std::vector<std::string> hasPathFromTo(const Node *, const Node *);
+    ///returns the paths from the first to the second node
+    std::vector<std::string> hasPathFromTo(int, int) const;
 
     friend class AutoParser;
+
+    friend class CompiledDetermAutomaton;
+
+    friend class AutoSerializer;
+
+    friend class AutoBuilder;
+
+    friend class PatternCache;
 };
 
 std::ostream &operator<<(std::ostream &out, const DetermAutomaton &myAuto);
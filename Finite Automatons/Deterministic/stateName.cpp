@@ -0,0 +1,47 @@
+#include "stateName.h"
+
+StateName::StateName(const std::string &text) : part{std::make_shared<const Part>(Part{text, nullptr, nullptr})} {}
+
+StateName::StateName(std::shared_ptr<const Part> myPart) : part{myPart} {}
+
+StateName StateName::pair(const StateName &firstName, const StateName &secondName)
+{
+    return StateName(std::make_shared<const Part>(Part{"", firstName.part, secondName.part}));
+}
+
+StateName StateName::withSuffix(const StateName &name, const std::string &suffix)
+{
+    return StateName(std::make_shared<const Part>(Part{suffix, name.part, nullptr}));
+}
+
+bool StateName::isPlain() const
+{
+    return part->first == nullptr;
+}
+
+std::string StateName::toString() const
+{
+    std::string result;
+    append(result, *part);
+    return result;
+}
+
+void StateName::append(std::string &result, const Part &myPart)
+{
+    if (myPart.first == nullptr)
+    {
+        result += myPart.text;
+        return;
+    }
+    if (myPart.second == nullptr)
+    {
+        append(result, *myPart.first);
+        result += myPart.text;
+        return;
+    }
+    result += "(";
+    append(result, *myPart.first);
+    result += ",";
+    append(result, *myPart.second);
+    result += ")";
+}
@@ -0,0 +1,39 @@
+#ifndef STATE_NAME_H
+#define STATE_NAME_H
+#include <string>
+#include <memory>
+
+///class StateName keeps the name of a node as a tree of the names it is made of and builds the string only when it is printed
+class StateName
+{
+    ///a part is a plain text, a pair of parts or a part followed by a suffix
+    struct Part
+    {
+        std::string text;
+        std::shared_ptr<const Part> first;
+        std::shared_ptr<const Part> second;
+    };
+
+    std::shared_ptr<const Part> part;
+
+    StateName(std::shared_ptr<const Part>);
+
+    static void append(std::string &, const Part &);
+
+public:
+    StateName(const std::string & = "");
+
+    ///returns the name "(first,second)" without copying the names
+    static StateName pair(const StateName &, const StateName &);
+
+    ///returns the name followed by the suffix without copying the name
+    static StateName withSuffix(const StateName &, const std::string &);
+
+    ///checks whether the name is a plain text given by the user and not built from other names
+    bool isPlain() const;
+
+    ///returns the text of the name
+    std::string toString() const;
+};
+
+#endif
@@ -64,6 +64,26 @@ void Console::doCommand()
         operation();
         return;
     }
+    if (command.compare("scan") == 0)
+    {
+        scanFile();
+        return;
+    }
+    if (command.compare("search") == 0)
+    {
+        searchFile();
+        return;
+    }
+    if (command.compare("save") == 0)
+    {
+        saveAuto();
+        return;
+    }
+    if (command.compare("load") == 0)
+    {
+        loadAuto();
+        return;
+    }
     std::cout << "Wrong command\n";
 }
 
@@ -92,10 +112,18 @@ void Console::parseRegExpression()
     std::cout << "Regular expression: ";
     std::string regExpr;
     std::cin >> regExpr;
-    Parser myRegParser(regExpr);
-    myRegParser.parse();
+    std::shared_ptr<const NondetermAutomaton> parsedAuto;
+    try
+    {
+        parsedAuto = PatternCache::getGlobal().getNondetermAutomaton(regExpr);
+    }
+    catch (std::invalid_argument a)
+    {
+        std::cout << a.what() << std::endl;
+        return;
+    }
     delete nondetAuto;
-    nondetAuto = new NondetermAutomaton(myRegParser.solve());
+    nondetAuto = new NondetermAutomaton(*parsedAuto);
     std::cout << "expression parsed!\n";
 }
 
@@ -225,9 +253,149 @@ void Console::wordFromStream()
     std::cout << std::endl;
 }
 
+void Console::scanFile()
+{
+    std::string path;
+    std::cout << "file: ";
+    std::cin >> path;
+    bool choice;
+    try
+    {
+        choice = choiceIsDetertm();
+    }
+    catch (std::invalid_argument a)
+    {
+        std::cout << a.what() << std::endl;
+        return;
+    }
+    if ((choice && !detAuto) || (!choice && !nondetAuto))
+    {
+        std::cout << "There is no auto!\n";
+        return;
+    }
+    std::vector<std::size_t> lines;
+    try
+    {
+        MappedFile file(path);
+        ThreadPool pool;
+        if (choice)
+        {
+            CompiledDetermAutomaton compiledAuto(*detAuto);
+            lines = LineScanner<CompiledDetermAutomaton>(compiledAuto, pool).getMatchingLines(file.getView());
+        }
+        else
+        {
+            BitsetNondetermAutomaton bitsetAuto(*nondetAuto);
+            lines = LineScanner<BitsetNondetermAutomaton>(bitsetAuto, pool).getMatchingLines(file.getView());
+        }
+    }
+    catch (std::exception &exc)
+    {
+        std::cout << exc.what() << std::endl;
+        return;
+    }
+    std::cout << lines.size() << " matching lines";
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        std::cout << (i ? ", " : ": ") << lines[i];
+    }
+    std::cout << std::endl;
+}
+
+void Console::searchFile()
+{
+    std::cout << "Regular expression: ";
+    std::string regExpr;
+    std::cin >> regExpr;
+    std::string path;
+    std::cout << "file: ";
+    std::cin >> path;
+    std::vector<Searcher::Match> matches;
+    try
+    {
+        std::shared_ptr<const NondetermAutomaton> parsedAuto = PatternCache::getGlobal().getNondetermAutomaton(regExpr);
+        LiteralPrefilter prefilter(regExpr);
+        MappedFile file(path);
+        matches = Searcher(*parsedAuto, &prefilter).findAll(file.getView());
+    }
+    catch (std::exception &exc)
+    {
+        std::cout << exc.what() << std::endl;
+        return;
+    }
+    std::cout << matches.size() << " matches";
+    for (int i = 0; i < matches.size(); ++i)
+    {
+        std::cout << (i ? ", " : ": ") << matches[i].first << '-' << matches[i].second;
+    }
+    std::cout << std::endl;
+}
+
+void Console::saveAuto()
+{
+    std::string path;
+    std::cout << "file: ";
+    std::cin >> path;
+    bool choice;
+    try
+    {
+        choice = choiceIsDetertm();
+    }
+    catch (std::invalid_argument a)
+    {
+        std::cout << a.what() << std::endl;
+        return;
+    }
+    if ((choice && !detAuto) || (!choice && !nondetAuto))
+    {
+        std::cout << "There is no auto!\n";
+        return;
+    }
+    try
+    {
+        AutoSerializer::save(choice ? AutoSerializer::serialize(*detAuto) : AutoSerializer::serialize(*nondetAuto), path);
+    }
+    catch (std::exception &exc)
+    {
+        std::cout << exc.what() << std::endl;
+        return;
+    }
+    std::cout << "auto saved!\n";
+}
+
+void Console::loadAuto()
+{
+    std::string path;
+    std::cout << "file: ";
+    std::cin >> path;
+    try
+    {
+        MappedFile file(path);
+        SerializedAutomaton serializedAuto(file.getView());
+        if (serializedAuto.isDeterministic())
+        {
+            DetermAutomaton *result = new DetermAutomaton(serializedAuto.toDetermAutomaton());
+            delete detAuto;
+            detAuto = result;
+        }
+        else
+        {
+            NondetermAutomaton *result = new NondetermAutomaton(serializedAuto.toNondetermAutomaton());
+            delete nondetAuto;
+            nondetAuto = result;
+        }
+    }
+    catch (std::exception &exc)
+    {
+        std::cout << exc.what() << std::endl;
+        return;
+    }
+    std::cout << "auto loaded!\n";
+}
+
 void Console::operation()
 {
-    std::cout << "Choose an operation: union/intersection(inter)/concatenation(concat)/complementation(complem)\n";
+    std::cout << "Choose an operation: union/intersection(inter)/concatenation(concat)/complementation(complem)/minimization(min)/determinization(det)\n";
     std::string choice;
     std::cin >> choice;
     if (choice.compare("union") == 0)
@@ -250,6 +418,16 @@ void Console::operation()
         concatenation();
         return;
     }
+    if (choice.compare("minimization") == 0 || choice.compare("min") == 0)
+    {
+        minimization();
+        return;
+    }
+    if (choice.compare("determinization") == 0 || choice.compare("det") == 0)
+    {
+        determinization();
+        return;
+    }
     std::cout << "wrong choice!\n";
 }
 
@@ -457,6 +635,30 @@ void Console ::concatenation()
     std::cout << "Succesful operation\n";
 }
 
+void Console ::minimization()
+{
+    if (!detAuto)
+    {
+        detAuto = enterDeterm();
+    }
+    DetermAutomaton *result = new DetermAutomaton(detAuto->minimize());
+    delete detAuto;
+    detAuto = result;
+    std::cout << "Succesful operation\n";
+}
+
+void Console ::determinization()
+{
+    if (!nondetAuto)
+    {
+        nondetAuto = enterNondeterm();
+    }
+    DetermAutomaton *result = new DetermAutomaton(nondetAuto->determinize());
+    delete detAuto;
+    detAuto = result;
+    std::cout << "Succesful operation\n";
+}
+
 void Console::help()
 {
     std::cout << "auto : builds an auto\n"
@@ -467,7 +669,11 @@ void Console::help()
               << "check : checks whether a word is from the language of an auto\n"
               << "stream : checks whether a word from a stream is from the language of an auto\n"
               << "show : prints info about an auto\n"
-              << "operation : performs an operation with an auto\n";
+              << "operation : performs an operation with an auto\n"
+              << "scan : prints the lines of a file which are from the language of an auto\n"
+              << "search : prints the positions of the words of a regular expression in a file\n"
+              << "save : writes an auto to a binary file\n"
+              << "load : reads an auto from a binary file\n";
 }
 
 void Console::myMain()
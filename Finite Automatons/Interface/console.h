@@ -1,9 +1,16 @@
 #ifndef CONSOLE_H
 #define CONSOLE_H
 #include "../Regular expressions to auto/regExpressionParser.h"
+#include "../Regular expressions to auto/patternCache.h"
 #include "../Auto to regular expression/autoParser.h"
 #include "../Nondeterministic/nondetermAuto.h"
 #include "../Deterministic/determAuto.h"
+#include "../Deterministic/compiledDetermAuto.h"
+#include "../Nondeterministic/bitsetNondetermAuto.h"
+#include "../Batch matching/lineScanner.h"
+#include "../Batch matching/mappedFile.h"
+#include "../Serialization/autoSerializer.h"
+#include "../Search/searcher.h"
 
 ///Class Console provides the user with the opportunity to use all the operations in the other classes.
 class Console
@@ -48,6 +55,18 @@ class Console
     ///checks whether the word from the stream is from the language of the deterministic auto
     void wordFromStream();
 
+    ///prints the numbers of the lines of a file which are from the language of the auto
+    void scanFile();
+
+    ///prints the positions of the words of a regular expression inside a file
+    void searchFile();
+
+    ///writes an auto to a binary file
+    void saveAuto();
+
+    ///reads an auto from a binary file
+    void loadAuto();
+
     ///ask the user with which automaton to work(determ or nondeterm)
     bool choiceIsDetertm();
 
@@ -66,6 +85,12 @@ class Console
     ///concatenates two autos
     void concatenation();
 
+    ///replaces the deterministic auto with the minimal one
+    void minimization();
+
+    ///replaces the deterministic auto with the determinized nondeterministic one
+    void determinization();
+
 public:
     Console();
 
@@ -3,8 +3,23 @@
 #define DOCTEST_CONFIG_IMPLEMENT
 #include "doctest.h"
 #include "../Deterministic/determAuto.h"
+#include "../Deterministic/compiledDetermAuto.h"
 #include "../Nondeterministic/nondetermAuto.h"
+#include "../Nondeterministic/lazyDetermAuto.h"
+#include "../Nondeterministic/bitsetNondetermAuto.h"
+#include "../Nondeterministic/autoBuilder.h"
 #include "../Regular expressions to auto/regExpressionParser.h"
+#include "../Regular expressions to auto/glushkovParser.h"
+#include "../Regular expressions to auto/derivativeAuto.h"
+#include "../Regular expressions to auto/literalPrefilter.h"
+#include "../Regular expressions to auto/patternCache.h"
+#include "../Batch matching/batchMatcher.h"
+#include "../Batch matching/lineScanner.h"
+#include "../Batch matching/mappedFile.h"
+#include "../Serialization/autoSerializer.h"
+#include "../Stream matching/streamMatcher.h"
+#include "../Search/searcher.h"
+#include "../Search/ahoCorasick.h"
 
 TEST_CASE("Test stream and Word from automaton")
 {
@@ -49,6 +64,81 @@ TEST_CASE("Test Word from automaton")
     CHECK(myAuto.isWordFromAuto(w));
 }
 
+TEST_CASE("Test word from compiled automaton")
+{
+    DetermAutomaton myAuto;
+    myAuto.addFirstNode("A");
+    myAuto.addTransition("A", '0', "A");
+    myAuto.addTransition("A", '1', "B");
+    myAuto.addTransition("B", '0', "C");
+    myAuto.addTransition("C", '1', "C");
+    myAuto.addTransition("C", '0', "B");
+    myAuto.addTransition("B", '1', "A");
+    myAuto.addFinals("A");
+    CompiledDetermAutomaton compiled(myAuto);
+
+    CHECK(compiled.getStatesCount() == 4);
+    CHECK(compiled.isWordFromAuto(""));
+    CHECK(compiled.isWordFromAuto("0000"));
+    CHECK(compiled.isWordFromAuto("01011110100"));
+    CHECK(!compiled.isWordFromAuto("0011000111"));
+    CHECK(!compiled.isWordFromAuto("0120"));
+
+    int state = compiled.transition(compiled.begin(), '2');
+    CHECK(compiled.isDeadState(state));
+    CHECK(compiled.isDeadState(compiled.transition(state, '0')));
+    CHECK(!compiled.isFinalState(state));
+
+    myAuto.addTransition("A", '2', "D");
+    myAuto.addTransition("D", '0', "D");
+    myAuto.addTransition("D", '1', "D");
+    CompiledDetermAutomaton sinkAuto(myAuto);
+    CHECK(sinkAuto.isDeadState(sinkAuto.transition(sinkAuto.begin(), '2')));
+    CHECK(!sinkAuto.isDeadState(sinkAuto.transition(sinkAuto.begin(), '1')));
+    CHECK(!sinkAuto.isWordFromAuto("2"));
+
+    DetermAutomaton noFinals;
+    noFinals.addFirstNode("A");
+    noFinals.addTransition("A", 'a', "A");
+    CHECK(CompiledDetermAutomaton(noFinals).isDeadState(CompiledDetermAutomaton(noFinals).begin()));
+}
+
+TEST_CASE("Test byte classes of automatons")
+{
+    DetermAutomaton numbers;
+    numbers.addFirstNode("A");
+    for (char digit = '0'; digit <= '9'; ++digit)
+    {
+        numbers.addTransition("A", digit, "B");
+        numbers.addTransition("B", digit, "B");
+    }
+    numbers.addTransition("B", '.', "C");
+    numbers.addTransition("C", '5', "D");
+    numbers.addFinals("B");
+    numbers.addFinals("D");
+
+    CompiledDetermAutomaton compiled(numbers);
+    CHECK(compiled.getClassesCount() == 4);
+    CHECK(compiled.isWordFromAuto("2024"));
+    CHECK(compiled.isWordFromAuto("3.5"));
+    CHECK(!compiled.isWordFromAuto("3.6"));
+    CHECK(!compiled.isWordFromAuto("12a"));
+
+    DetermAutomaton minimal = numbers.minimize();
+    CHECK(minimal.isWordFromAuto("12.5"));
+    CHECK(!minimal.isWordFromAuto("12."));
+
+    ByteClasses byteClasses;
+    byteClasses.add(0, 'a', 1);
+    byteClasses.add(0, 'b', 1);
+    byteClasses.add(1, 'b', 1);
+    byteClasses.build();
+    CHECK(byteClasses.getClassesCount() == 3);
+    CHECK(byteClasses.getClass('a') != byteClasses.getClass('b'));
+    CHECK(byteClasses.getClass('c') == byteClasses.getClass('z'));
+    CHECK(byteClasses.getChars(byteClasses.getClass('a')) == "a");
+}
+
 TEST_CASE("Test complementation of an automaton")
 {
     DetermAutomaton myAuto;
@@ -137,6 +227,92 @@ TEST_CASE("Test union of deterministic automatons")
     CHECK(!newAuto.isWordFromAuto(w));
 }
 
+TEST_CASE("Test product of partial deterministic automatons")
+{
+    DetermAutomaton a, b;
+    a.addFirstNode("X0");
+    a.addTransition("X0", 'a', "X1");
+    a.addTransition("X1", 'a', "X1");
+    a.addTransition("X1", 'c', "X2");
+    a.addFinals("X1");
+
+    b.addFirstNode("Y0");
+    b.addTransition("Y0", 'b', "Y1");
+    b.addTransition("Y0", 'a', "Y2");
+    b.addTransition("Y2", 'b', "Y1");
+    b.addFinals("Y1");
+
+    DetermAutomaton united = DetermAutomaton::unions(a, b);
+    CHECK(united.isWordFromAuto("aaa"));
+    CHECK(united.isWordFromAuto("b"));
+    CHECK(united.isWordFromAuto("ab"));
+    CHECK(!united.isWordFromAuto("aac"));
+    CHECK(!united.isWordFromAuto("ba"));
+
+    DetermAutomaton intersected = DetermAutomaton::intersection(a, b);
+    CHECK(CompiledDetermAutomaton(intersected).getStatesCount() == 3);
+    CHECK(!intersected.isWordFromAuto("a"));
+    CHECK(!intersected.isWordFromAuto("ab"));
+}
+
+TEST_CASE("Test minimization of deterministic automatons")
+{
+    DetermAutomaton myAuto;
+    myAuto.addFirstNode("A");
+    myAuto.addTransition("A", '0', "B");
+    myAuto.addTransition("A", '1', "C");
+    myAuto.addTransition("B", '0', "D");
+    myAuto.addTransition("B", '1', "D");
+    myAuto.addTransition("C", '0', "E");
+    myAuto.addTransition("C", '1', "E");
+    myAuto.addTransition("D", '0', "D");
+    myAuto.addTransition("E", '0', "E");
+    myAuto.addTransition("D", '1', "F");
+    myAuto.addTransition("F", '1', "F");
+    myAuto.addFinals("D");
+    myAuto.addFinals("E");
+
+    DetermAutomaton minimal = myAuto.minimize();
+    CHECK(CompiledDetermAutomaton(minimal).getStatesCount() == 4);
+
+    std::string words[] = {"", "0", "00", "01", "10", "11", "000", "0100", "011", "1000", "10001"};
+    for (int i = 0; i < 11; ++i)
+    {
+        CHECK(minimal.isWordFromAuto(words[i]) == myAuto.isWordFromAuto(words[i]));
+    }
+
+    DetermAutomaton a, b;
+    a.addFirstNode("X0");
+    a.addTransition("X0", '0', "X0");
+    a.addTransition("X0", '1', "X1");
+    a.addTransition("X1", '1', "X0");
+    a.addTransition("X1", '0', "X1");
+    a.addFinals("X1");
+
+    b.addFirstNode("Y0");
+    b.addTransition("Y0", '0', "Y0");
+    b.addTransition("Y0", '1', "Y1");
+    b.addTransition("Y1", '1', "Y0");
+    b.addTransition("Y1", '0', "Y1");
+    b.addFinals("Y1");
+
+    DetermAutomaton c = DetermAutomaton::intersection(a, b).minimize();
+    CHECK(CompiledDetermAutomaton(c).getStatesCount() == 3);
+    std::string w = "0100";
+    CHECK(c.isWordFromAuto(w));
+    w = "0110";
+    CHECK(!c.isWordFromAuto(w));
+
+    DetermAutomaton empty;
+    empty.addFirstNode("A");
+    empty.addTransition("A", '0', "B");
+    empty.addTransition("B", '0', "A");
+    DetermAutomaton minimalEmpty = empty.minimize();
+    CHECK(CompiledDetermAutomaton(minimalEmpty).getStatesCount() == 2);
+    w = "00";
+    CHECK(!minimalEmpty.isWordFromAuto(w));
+}
+
 TEST_CASE("Test Word from nondetermnistic automaton")
 {
     NondetermAutomaton myAuto;
@@ -165,6 +341,32 @@ TEST_CASE("Test Word from nondetermnistic automaton")
     CHECK(myAuto.isWordFromAuto(w));
 }
 
+TEST_CASE("Test epsilon closures of a nondeterministic automaton")
+{
+    NondetermAutomaton myAuto;
+    myAuto.addFirstNode("0");
+    myAuto.addTransition("0", '@', "1");
+    myAuto.addTransition("1", '@', "2");
+    myAuto.addTransition("2", '@', "0");
+    myAuto.addTransition("2", 'a', "3");
+    myAuto.addTransition("3", '@', "4");
+    myAuto.addFinals("4");
+
+    CHECK(myAuto.isWordFromAuto("a"));
+    CHECK(!myAuto.isWordFromAuto(""));
+    CHECK(!myAuto.isWordFromAuto("aa"));
+
+    myAuto.addTransition("4", '@', "0");
+    CHECK(myAuto.isWordFromAuto("aa"));
+    myAuto.addTransition("1", '@', "4");
+    CHECK(myAuto.isWordFromAuto(""));
+
+    NondetermAutomaton starAuto = NondetermAutomaton::kleeneStar(NondetermAutomaton("ab"));
+    CHECK(starAuto.isWordFromAuto(""));
+    CHECK(starAuto.isWordFromAuto("ababab"));
+    CHECK(!starAuto.isWordFromAuto("aba"));
+}
+
 TEST_CASE("Test complementation of a nondeterministic automaton")
 {
     NondetermAutomaton myAuto;
@@ -420,6 +622,797 @@ TEST_CASE("Test parsing regular expression with intersection to an auto")
     CHECK(!myAuto.isWordFromAuto("abcc"));
 }
 
+TEST_CASE("Test determinization of a regular expression auto")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    DetermAutomaton determ = myAuto.determinize();
+
+    std::string words[] = {"ababcca", "ababca", "ababcccccca", "abbcbcabcbcca", "abca", "ababcabcbcabcccabca",
+                           "abcabcbcabcccabca", "abacca", "caca", "abcc", ""};
+    for (int i = 0; i < 11; ++i)
+    {
+        CHECK(determ.isWordFromAuto(words[i]) == myAuto.isWordFromAuto(words[i]));
+    }
+
+    std::string epsilon = "@+ab";
+    Parser epsilonParser{epsilon};
+    DetermAutomaton epsilonAuto = epsilonParser.solve().determinize();
+    CHECK(epsilonAuto.isWordFromAuto(""));
+    CHECK(epsilonAuto.isWordFromAuto("ab"));
+    CHECK(!epsilonAuto.isWordFromAuto("a"));
+}
+
+TEST_CASE("Test position automaton of a regular expression")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    GlushkovParser glushkovParser{str};
+    NondetermAutomaton positionAuto(glushkovParser.solve());
+    CHECK(BitsetNondetermAutomaton(positionAuto).getStatesCount() == 10);
+
+    std::string words[] = {"ababcca", "ababca", "ababcccccca", "abbcbcabcbcca", "abca", "ababcabcbcabcccabca",
+                           "abcabcbcabcccabca", "abacca", "caca", "abcc", ""};
+    for (int i = 0; i < 11; ++i)
+    {
+        CHECK(positionAuto.isWordFromAuto(words[i]) == myAuto.isWordFromAuto(words[i]));
+    }
+
+    std::string epsilon = "(@+ab)*.b*";
+    NondetermAutomaton epsilonAuto = GlushkovParser(epsilon).solve();
+    CHECK(epsilonAuto.isWordFromAuto(""));
+    CHECK(epsilonAuto.isWordFromAuto("ababbb"));
+    CHECK(!epsilonAuto.isWordFromAuto("aba"));
+
+    std::string intersected = "(ab.a*)&(a*.b.a)";
+    NondetermAutomaton intersectedAuto = GlushkovParser(intersected).solve();
+    CHECK(intersectedAuto.isWordFromAuto("aba"));
+    CHECK(!intersectedAuto.isWordFromAuto("ab"));
+    CHECK(!intersectedAuto.isWordFromAuto("abaa"));
+
+    CHECK_THROWS_AS(GlushkovParser("a+").solve(), std::invalid_argument);
+
+    // both parsers read the expression with the same tokenizer, so an unclosed bracket is skipped by both
+    std::string unclosed = "(ab+b*";
+    NondetermAutomaton unclosedAuto = GlushkovParser(unclosed).solve();
+    CHECK(unclosedAuto.isWordFromAuto("ab"));
+    CHECK(unclosedAuto.isWordFromAuto("bb"));
+    CHECK(Parser(unclosed).solve().isWordFromAuto("bb"));
+    CHECK(!unclosedAuto.isWordFromAuto("abb"));
+}
+
+TEST_CASE("Test derivatives of a regular expression")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    DerivativeAutomaton derivativeAuto(str);
+
+    std::string words[] = {"ababcca", "ababca", "ababcccccca", "abbcbcabcbcca", "abca", "ababcabcbcabcccabca",
+                           "abcabcbcabcccabca", "abacca", "caca", "abcc", ""};
+    for (int i = 0; i < 11; ++i)
+    {
+        CHECK(derivativeAuto.isWordFromAuto(words[i]) == myAuto.isWordFromAuto(words[i]));
+    }
+
+    std::string intersected = "((a+b)*.a.(a+b)*)&((a+b)*.aa.(a+b)*)~";
+    DerivativeAutomaton intersectedAuto(intersected, 4);
+    CHECK(intersectedAuto.isWordFromAuto("babab"));
+    CHECK(intersectedAuto.isWordFromAuto("a"));
+    CHECK(!intersectedAuto.isWordFromAuto("baab"));
+    CHECK(!intersectedAuto.isWordFromAuto("bbb"));
+    CHECK(!intersectedAuto.isWordFromAuto("bcb"));
+    CHECK(intersectedAuto.getCachedStatesCount() <= 4);
+
+    DerivativeAutomaton complementAuto("ab~");
+    CHECK(complementAuto.isWordFromAuto("a"));
+    CHECK(complementAuto.isWordFromAuto("acd"));
+    CHECK(!complementAuto.isWordFromAuto("ab"));
+    CHECK(!complementAuto.isWordFromAuto(""));
+    CHECK(complementAuto.isDeadState(complementAuto.transition(complementAuto.begin(), 'b')));
+
+    DerivativeAutomaton disjointAuto("a&b");
+    CHECK(disjointAuto.isDeadState(disjointAuto.begin()));
+    DerivativeAutomaton prefixAuto("(a.b)&(a.c)");
+    CHECK(!prefixAuto.isDeadState(prefixAuto.begin()));
+    CHECK(prefixAuto.isDeadState(prefixAuto.transition(prefixAuto.begin(), 'a')));
+    DerivativeAutomaton contradictionAuto("(a+b)&(a+b)~");
+    CHECK(contradictionAuto.isDeadState(contradictionAuto.begin()));
+    CHECK(DerivativeAutomaton("@&a*").isWordFromAuto(""));
+
+    CHECK_THROWS_AS(DerivativeAutomaton("a+"), std::invalid_argument);
+
+    // a long string and a long concatenation are built with a term for every char
+    std::string literal;
+    for (int i = 0; i < 20000; ++i)
+    {
+        literal.push_back('a' + i % 7);
+    }
+    DerivativeAutomaton literalAuto(literal + "." + literal, 50000);
+    CHECK(literalAuto.isWordFromAuto(literal + literal));
+    CHECK(!literalAuto.isWordFromAuto(literal));
+}
+
+TEST_CASE("Test linear construction of long regular expressions")
+{
+    std::string str = "ab";
+    for (int i = 0; i < 2000; ++i)
+    {
+        str += i % 2 ? "+ab" : ".(ba)*";
+    }
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    CHECK(BitsetNondetermAutomaton(myAuto).getStatesCount() < 10 * str.size());
+    CHECK(myAuto.isWordFromAuto("ab"));
+    CHECK(myAuto.isWordFromAuto("abbaba"));
+    CHECK(!myAuto.isWordFromAuto("aba"));
+    CHECK(parser.solve().isWordFromAuto("abba"));
+
+    std::string intersected = "(ab.a*)&(a*.b.a)";
+    Parser intersectedParser{intersected};
+    NondetermAutomaton intersectedAuto(intersectedParser.solve());
+    CHECK(intersectedAuto.isWordFromAuto("aba"));
+    CHECK(!intersectedAuto.isWordFromAuto("ab"));
+    CHECK(!intersectedAuto.isWordFromAuto("abaa"));
+
+    std::string invalid = "a+";
+    Parser invalidParser{invalid};
+    CHECK_THROWS_AS(invalidParser.solve(), std::invalid_argument);
+}
+
+TEST_CASE("Test caching compiled regular expressions")
+{
+    PatternCache cache;
+    std::shared_ptr<const NondetermAutomaton> first = cache.getNondetermAutomaton("ab.(ba)*");
+    std::shared_ptr<const NondetermAutomaton> second = cache.getNondetermAutomaton("ab.(ba)*");
+    CHECK(first == second);
+    CHECK(cache.getHits() == 1);
+    CHECK(cache.getMisses() == 1);
+
+    std::shared_ptr<const DetermAutomaton> determ = cache.getDetermAutomaton("ab.(ba)*");
+    CHECK(determ == cache.getDetermAutomaton("ab.(ba)*"));
+    CHECK(CompiledDetermAutomaton(*determ).isWordFromAuto("abba"));
+    CHECK(!CompiledDetermAutomaton(*cache.getMinimalAutomaton("ab.(ba)*")).isWordFromAuto("aba"));
+    CHECK(cache.getHits() == 2);
+    CHECK(cache.getMisses() == 3);
+    CHECK(cache.getSize() == 1);
+    CHECK_THROWS_AS(cache.getNondetermAutomaton("a+"), std::invalid_argument);
+    CHECK(cache.getSize() == 1);
+
+    std::size_t memory = cache.getMemoryUsage();
+    cache.setMaxMemory(memory);
+    cache.getNondetermAutomaton("b.a");
+    CHECK(cache.getSize() == 1);
+    CHECK(cache.getEvictions() == 1);
+    CHECK(!first->isEmpty());
+    cache.getNondetermAutomaton("ab.(ba)*");
+    CHECK(cache.getMisses() == 6);
+
+    cache.clear();
+    CHECK(cache.getSize() == 0);
+    CHECK(cache.getMemoryUsage() == 0);
+    CHECK(&PatternCache::getGlobal() == &PatternCache::getGlobal());
+}
+
+TEST_CASE("Test lazy determinization of a regular expression auto")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    LazyDetermAutomaton lazyAuto(myAuto);
+    LazyDetermAutomaton smallCacheAuto(myAuto, 4);
+
+    CHECK(lazyAuto.getCachedStatesCount() == 2);
+    std::string words[] = {"ababcca", "ababca", "ababcccccca", "abbcbcabcbcca", "abca", "ababcabcbcabcccabca",
+                           "abcabcbcabcccabca", "abacca", "caca", "abcc", ""};
+    for (int i = 0; i < 11; ++i)
+    {
+        CHECK(lazyAuto.isWordFromAuto(words[i]) == myAuto.isWordFromAuto(words[i]));
+        CHECK(smallCacheAuto.isWordFromAuto(words[i]) == myAuto.isWordFromAuto(words[i]));
+    }
+    int cachedStates = lazyAuto.getCachedStatesCount();
+    CHECK(lazyAuto.isWordFromAuto("ababcca"));
+    CHECK(lazyAuto.getCachedStatesCount() == cachedStates);
+    CHECK(smallCacheAuto.getCachedStatesCount() <= 4);
+
+    int state = lazyAuto.transition(lazyAuto.begin(), 'x');
+    CHECK(lazyAuto.isDeadState(state));
+    CHECK(!lazyAuto.isFinalState(state));
+}
+
+TEST_CASE("Test bitset simulation of nondeterministic automatons")
+{
+    NondetermAutomaton myAuto;
+    myAuto.addFirstNode("0");
+    myAuto.addTransition("0", '@', "1");
+    myAuto.addTransition("0", '@', "4");
+    myAuto.addTransition("1", 'a', "2");
+    myAuto.addTransition("2", 'a', "2");
+    myAuto.addTransition("2", 'b', "2");
+    myAuto.addTransition("2", 'a', "3");
+    myAuto.addTransition("4", 'b', "5");
+    myAuto.addTransition("5", 'a', "5");
+    myAuto.addTransition("5", 'b', "5");
+    myAuto.addTransition("5", 'b', "6");
+    myAuto.addTransition("6", '@', "7");
+    myAuto.addTransition("3", '@', "7");
+    myAuto.addFinals("7");
+    BitsetNondetermAutomaton smallAuto(myAuto);
+
+    CHECK(smallAuto.getStatesCount() == 8);
+    CHECK(smallAuto.isWordFromAuto("aaaaa"));
+    CHECK(!smallAuto.isWordFromAuto("a"));
+    CHECK(!smallAuto.isWordFromAuto("baaa"));
+    CHECK(smallAuto.isWordFromAuto("aabbbba"));
+    CHECK(!smallAuto.isWordFromAuto("aabcbba"));
+
+    std::string word(100, 'a');
+    NondetermAutomaton wordAuto(word);
+    BitsetNondetermAutomaton bigAuto(NondetermAutomaton::kleeneStar(wordAuto));
+    CHECK(bigAuto.getStatesCount() == 101);
+    CHECK(bigAuto.isWordFromAuto(""));
+    CHECK(bigAuto.isWordFromAuto(word + word));
+    CHECK(!bigAuto.isWordFromAuto(word + "a"));
+    CHECK(!bigAuto.isWordFromAuto("b"));
+    CHECK(bigAuto.hasDenseMasks());
+
+    std::string longWord(20000, 'a');
+    longWord[10000] = 'b';
+    NondetermAutomaton longWordAuto(longWord);
+    BitsetNondetermAutomaton hugeAuto(NondetermAutomaton::kleeneStar(longWordAuto));
+    CHECK(hugeAuto.getStatesCount() == 20001);
+    CHECK(!hugeAuto.hasDenseMasks());
+    CHECK(hugeAuto.isWordFromAuto(""));
+    CHECK(hugeAuto.isWordFromAuto(longWord + longWord));
+    CHECK(!hugeAuto.isWordFromAuto(longWord + "a"));
+    CHECK(!hugeAuto.isWordFromAuto(std::string(20000, 'a')));
+}
+
+TEST_CASE("Test batch matching of words")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    CompiledDetermAutomaton compiledAuto(myAuto.determinize());
+    BitsetNondetermAutomaton bitsetAuto(myAuto);
+    ThreadPool pool(4);
+    CHECK(pool.getThreadsCount() == 4);
+
+    std::string words[] = {"ababcca", "ababca", "ababcccccca", "abbcbcabcbcca", "abca", "ababcabcbcabcccabca",
+                           "abcabcbcabcccabca", "abacca", "caca", "abcc", ""};
+    std::string buffer;
+    std::vector<std::size_t> offsets{0};
+    std::vector<std::string_view> batch;
+    for (int i = 0; i < 10000; ++i)
+    {
+        buffer += words[i % 11];
+        offsets.push_back(buffer.size());
+    }
+    for (int i = 0; i < 10000; ++i)
+    {
+        batch.push_back(std::string_view(buffer.data() + offsets[i], offsets[i + 1] - offsets[i]));
+    }
+
+    BatchMatcher<CompiledDetermAutomaton> compiledMatcher(compiledAuto, pool);
+    BatchMatcher<BitsetNondetermAutomaton> bitsetMatcher(bitsetAuto, pool);
+    std::vector<std::uint64_t> compiledResult = compiledMatcher.areWordsFromAuto(batch);
+    std::vector<std::uint64_t> bitsetResult = bitsetMatcher.areWordsFromAuto(buffer, offsets);
+    CHECK(compiledResult.size() == 157);
+    CHECK(compiledResult == bitsetResult);
+    bool isSame = true;
+    for (int i = 0; i < 10000; ++i)
+    {
+        isSame = isSame && BatchMatcher<CompiledDetermAutomaton>::isWordAccepted(compiledResult, i) == myAuto.isWordFromAuto(words[i % 11]);
+    }
+    CHECK(isSame);
+    CHECK(compiledMatcher.areWordsFromAuto(std::vector<std::string_view>()).empty());
+
+    std::vector<int> isRun(100, 0);
+    CHECK_THROWS_AS(pool.run(100, [&isRun](int index)
+                             {
+                                 isRun[index] = 1;
+                                 if (index % 7 == 3)
+                                 {
+                                     throw std::out_of_range("Invalid task");
+                                 } }),
+                    std::out_of_range);
+    bool isAllRun = true;
+    for (int i = 0; i < isRun.size(); ++i)
+    {
+        isAllRun = isAllRun && isRun[i];
+    }
+    CHECK(isAllRun);
+    CHECK(compiledMatcher.areWordsFromAuto(batch) == compiledResult);
+}
+
+TEST_CASE("Test stream matching of chunks")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    CompiledDetermAutomaton compiledAuto(myAuto.determinize());
+    LazyDetermAutomaton lazyAuto(myAuto);
+    StreamMatcher<CompiledDetermAutomaton> compiledMatcher(compiledAuto);
+    StreamMatcher<LazyDetermAutomaton> lazyMatcher(lazyAuto);
+
+    std::string chunks[] = {"ab", "", "abc", "cc bc", "a"};
+    CHECK(compiledMatcher.getStatus() == StreamMatcher<CompiledDetermAutomaton>::Status::Rejecting);
+    CHECK(compiledMatcher.feed(chunks[0]) == StreamMatcher<CompiledDetermAutomaton>::Status::Rejecting);
+    CHECK(compiledMatcher.feed(chunks[1]) == StreamMatcher<CompiledDetermAutomaton>::Status::Rejecting);
+    CHECK(compiledMatcher.feed(chunks[2]) == StreamMatcher<CompiledDetermAutomaton>::Status::Rejecting);
+    CHECK(compiledMatcher.feed(chunks[3]) == StreamMatcher<CompiledDetermAutomaton>::Status::Dead);
+    CHECK(compiledMatcher.isDead());
+    CHECK(compiledMatcher.feed(chunks[4]) == StreamMatcher<CompiledDetermAutomaton>::Status::Dead);
+    CHECK(compiledMatcher.getFedCount() == 11);
+
+    compiledMatcher.reset();
+    std::string word = "ababcabcbcabcccabca";
+    for (int i = 0; i < word.size(); i += 4)
+    {
+        compiledMatcher.feed(word.substr(i, 4));
+        lazyMatcher.feed(word.substr(i, 4));
+    }
+    CHECK(compiledMatcher.isAccepting());
+    CHECK(lazyMatcher.isAccepting());
+    CHECK(lazyMatcher.feed("c") == StreamMatcher<LazyDetermAutomaton>::Status::Dead);
+    lazyMatcher.reset();
+    CHECK(lazyMatcher.feed("abab") == StreamMatcher<LazyDetermAutomaton>::Status::Rejecting);
+    CHECK(lazyMatcher.feed("cca") == StreamMatcher<LazyDetermAutomaton>::Status::Accepting);
+
+    // every word which starts with a is in the language, so its complement has a sink after a
+    DetermAutomaton prefixAuto;
+    prefixAuto.addFirstNode("A");
+    prefixAuto.addTransition("A", 'a', "B");
+    prefixAuto.addTransition("A", 'b', "A");
+    prefixAuto.addTransition("B", 'a', "B");
+    prefixAuto.addTransition("B", 'b', "B");
+    prefixAuto.addFinals("B");
+    CompiledDetermAutomaton complementAuto(prefixAuto.complementation());
+    StreamMatcher<CompiledDetermAutomaton> complementMatcher(complementAuto);
+    CHECK(complementMatcher.feed("bb") == StreamMatcher<CompiledDetermAutomaton>::Status::Accepting);
+    CHECK(complementMatcher.feed("ab") == StreamMatcher<CompiledDetermAutomaton>::Status::Dead);
+    CHECK(complementMatcher.isDead());
+
+    DetermAutomaton sink;
+    sink.addFirstNode("A");
+    sink.addTransition("A", 'a', "B");
+    sink.addTransition("B", 'a', "C");
+    sink.addTransition("C", 'a', "C");
+    sink.addTransition("C", 'b', "C");
+    sink.addFinals("B");
+    CompiledDetermAutomaton sinkAuto(sink);
+    StreamMatcher<CompiledDetermAutomaton> sinkMatcher(sinkAuto);
+    CHECK(sinkMatcher.feed("a") == StreamMatcher<CompiledDetermAutomaton>::Status::Accepting);
+    CHECK(sinkMatcher.feed("ab") == StreamMatcher<CompiledDetermAutomaton>::Status::Dead);
+    CHECK(sinkMatcher.getFedCount() == 3);
+
+    NondetermAutomaton sinkNondeterm;
+    sinkNondeterm.addFirstNode("A");
+    sinkNondeterm.addTransition("A", 'a', "B");
+    sinkNondeterm.addTransition("A", 'a', "C");
+    sinkNondeterm.addTransition("C", 'a', "C");
+    sinkNondeterm.addFinals("B");
+    LazyDetermAutomaton lazySinkAuto(sinkNondeterm);
+    StreamMatcher<LazyDetermAutomaton> lazySinkMatcher(lazySinkAuto);
+    CHECK(lazySinkMatcher.feed("a") == StreamMatcher<LazyDetermAutomaton>::Status::Accepting);
+    CHECK(lazySinkMatcher.feed("a") == StreamMatcher<LazyDetermAutomaton>::Status::Dead);
+    sinkNondeterm.addTransition("A", 'b', "A");
+    NondetermAutomaton noFinals = NondetermAutomaton::intersection(sinkNondeterm, NondetermAutomaton("b"));
+    LazyDetermAutomaton lazyNoFinals(noFinals);
+    CHECK(lazyNoFinals.isDeadState(lazyNoFinals.begin()));
+    CHECK(!lazyNoFinals.isWordFromAuto("b"));
+}
+
+TEST_CASE("Test scanning lines of a text")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    CompiledDetermAutomaton compiledAuto(parser.solve().determinize());
+    ThreadPool pool(3);
+    std::string text;
+    std::vector<std::size_t> expected;
+    for (int i = 1; i <= 1000; ++i)
+    {
+        if (i % 7 == 0)
+        {
+            text += "ababcca\n";
+            expected.push_back(i);
+        }
+        else if (i % 11 == 0)
+        {
+            text += "abca\r\n";
+            expected.push_back(i);
+        }
+        else
+        {
+            text += "abcc\n";
+        }
+    }
+    text += "ababca";
+    expected.push_back(1001);
+
+    LineScanner<CompiledDetermAutomaton> scanner(compiledAuto, pool, 64);
+    CHECK(scanner.getMatchingLines(text) == expected);
+    CHECK(scanner.countMatchingLines(text) == expected.size());
+    CHECK(scanner.getMatchingLines("").empty());
+    CHECK(scanner.getMatchingLines("abca\n\nabca\n") == std::vector<std::size_t>{1, 3});
+
+    CHECK_THROWS_AS(MappedFile("no such file"), std::invalid_argument);
+}
+
+TEST_CASE("Test literal prefilter of a regular expression")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+    LiteralPrefilter prefilter(str);
+    CHECK(prefilter.getPrefix() == "ab");
+    CHECK(prefilter.getSuffix() == "ca");
+    CHECK(prefilter.getFactor() == "ab");
+    CHECK(prefilter.mayBeWord("abca"));
+    CHECK(!prefilter.mayBeWord("bca"));
+    CHECK(LiteralPrefilter("x*.(error+errno).y").getFactor() == "err");
+    CHECK(LiteralPrefilter("(ab)*+c").getFactor().empty());
+    CHECK(LiteralPrefilter::findLiteral("aabaab", "ab", 2) == 4);
+    CHECK(LiteralPrefilter::findLiteral("aabaab", "abb", 0) == std::string_view::npos);
+
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    CompiledDetermAutomaton compiledAuto(myAuto.determinize());
+    Searcher searcher(myAuto, &prefilter);
+    Searcher plainSearcher(myAuto);
+    std::string text = "xxabcaxabababcccax";
+    CHECK(searcher.findLeftmostLongest(text) == Searcher::Match(2, 6));
+    CHECK(searcher.findLeftmostLongest(text, 3) == plainSearcher.findLeftmostLongest(text, 3));
+    CHECK(searcher.findLeftmostLongest(text, 3) == Searcher::Match(7, 17));
+    CHECK(!searcher.findLeftmostLongest(text, 10));
+    CHECK(!searcher.findLeftmostLongest(""));
+
+    // the prefix is everywhere, so a word which is read from every candidate reads the whole text every time
+    std::string prefixes;
+    for (int i = 0; i < 100000; ++i)
+    {
+        prefixes += "ab";
+    }
+    CHECK(searcher.findAll(prefixes).empty());
+    CHECK(searcher.findLeftmostLongest(prefixes + "ca") == Searcher::Match(0, 200002));
+    CHECK(searcher.findAll("x" + prefixes + "ca") == std::vector<Searcher::Match>{{1, 200003}});
+
+    ThreadPool pool(2);
+    std::string lines = "abca\nbcab\nababcca\nabab";
+    CHECK(LineScanner<CompiledDetermAutomaton>(compiledAuto, pool, 0, &prefilter).getMatchingLines(lines) ==
+          std::vector<std::size_t>{1, 3});
+}
+
+TEST_CASE("Test unions of words as a trie")
+{
+    std::string str = "he+(she+his)+hers+@";
+    Parser parser{str};
+    REQUIRE(parser.getLiteralWords());
+    CHECK(*parser.getLiteralWords() == std::vector<std::string>{"he", "she", "his", "hers", ""});
+    NondetermAutomaton myAuto(parser.solve());
+    CHECK(BitsetNondetermAutomaton(myAuto).getStatesCount() == 10);
+    CHECK(myAuto.isWordFromAuto("hers"));
+    CHECK(myAuto.isWordFromAuto(""));
+    CHECK(!myAuto.isWordFromAuto("her"));
+    std::string notLiteral = "he+she*";
+    CHECK(!Parser(notLiteral).getLiteralWords());
+
+    AhoCorasickAutomaton searcher({"he", "she", "his", "hers"});
+    CHECK(searcher.isWordFromAuto("she"));
+    CHECK(!searcher.isWordFromAuto("sh"));
+    CHECK(searcher.findAll("ushers") == std::vector<std::pair<std::size_t, std::size_t>>{{1, 4}, {2, 4}, {2, 6}});
+    CHECK(searcher.findAll("xyz").empty());
+    CHECK(searcher.toDetermAutomaton().isWordFromAuto("his"));
+
+    std::string words = "he+(she+his)+hers";
+    LiteralPrefilter wordsFilter(words);
+    CHECK(wordsFilter.mayBeWord("hers"));
+    CHECK(!wordsFilter.mayBeWord("her"));
+    CHECK(!wordsFilter.mayContain("xyz hx"));
+    CHECK(wordsFilter.findCandidate("xxxushers", 0) == 3);
+    CHECK(LiteralPrefilter(str).mayContain("xyz"));
+    Searcher wordsSearcher(Parser(words).solve(), &wordsFilter);
+    CHECK(wordsSearcher.findAll("xxxushers his") == std::vector<Searcher::Match>{{4, 7}, {10, 13}});
+}
+
+TEST_CASE("Test searching words of an automaton in a text")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+    Parser parser{str};
+    NondetermAutomaton myAuto(parser.solve());
+    CHECK(myAuto.reversal().isWordFromAuto("acba"));
+    CHECK(!myAuto.reversal().isWordFromAuto("abca"));
+    CHECK(myAuto.unanchored().isWordFromAuto("xyzabca"));
+    CHECK(!myAuto.unanchored().isWordFromAuto("abcax"));
+
+    LiteralPrefilter prefilter(str);
+    Searcher finder(myAuto, &prefilter);
+    std::string text = "xxabcaxabababcccax";
+    CHECK(finder.findFirst(text) == Searcher::Match(2, 6));
+    CHECK(finder.findFirst(text, 3) == Searcher::Match(7, 17));
+    CHECK(finder.findLeftmostLongest(text, 3) == Searcher::Match(7, 17));
+    CHECK(finder.findAll(text) == std::vector<Searcher::Match>{{2, 6}, {7, 17}});
+    CHECK(!finder.findFirst(text, 10));
+    CHECK(finder.findAll("").empty());
+
+    std::string repeated = "a*.b+b.a*";
+    Parser repeatedParser{repeated};
+    Searcher repeatedFinder(repeatedParser.solve());
+    CHECK(repeatedFinder.findFirst("xaab") == Searcher::Match(1, 4));
+    CHECK(repeatedFinder.findLeftmostLongest("xbaa") == Searcher::Match(1, 4));
+    CHECK(repeatedFinder.findAll("aabaaxbb") == std::vector<Searcher::Match>{{0, 3}, {6, 7}, {7, 8}});
+
+    // every a starts a word which may go on to a b, so reading to the end of the text for every word is quadratic
+    std::string pending = "a+a.(a+b)*.b";
+    Parser pendingParser{pending};
+    Searcher pendingFinder(pendingParser.solve());
+    std::string longText(200000, 'a');
+    std::vector<Searcher::Match> matches = pendingFinder.findAll(longText);
+    CHECK(matches.size() == 200000);
+    CHECK(matches.back() == Searcher::Match(199999, 200000));
+    CHECK(pendingFinder.findLeftmostLongest(longText + "b", 5) == Searcher::Match(5, 200001));
+}
+
+TEST_CASE("Test serialization of automatons")
+{
+    std::string str = "ab.(abc*+bc)*.ca";
+
+    Parser parser{str};
+    NondetermAutomaton nondetAuto(parser.solve());
+    DetermAutomaton detAuto(nondetAuto.determinize());
+
+    std::string detBytes = AutoSerializer::serialize(detAuto);
+    std::string nondetBytes = AutoSerializer::serialize(nondetAuto);
+    SerializedAutomaton serializedDet(detBytes);
+    SerializedAutomaton serializedNondet(nondetBytes);
+    CHECK(serializedDet.isDeterministic());
+    CHECK(!serializedNondet.isDeterministic());
+    DetermAutomaton loadedDet = serializedDet.toDetermAutomaton();
+    NondetermAutomaton loadedNondet = serializedNondet.toNondetermAutomaton();
+
+    std::string words[] = {"ababcca", "ababca", "ababcccccca", "abbcbcabcbcca", "abca", "ababcabcbcabcccabca",
+                           "abcabcbcabcccabca", "abacca", "caca", "abcc", ""};
+    for (int i = 0; i < 11; ++i)
+    {
+        bool isFromAuto = nondetAuto.isWordFromAuto(words[i]);
+        CHECK(serializedDet.isWordFromAuto(words[i]) == isFromAuto);
+        CHECK(serializedNondet.isWordFromAuto(words[i]) == isFromAuto);
+        CHECK(loadedDet.isWordFromAuto(words[i]) == isFromAuto);
+        CHECK(loadedNondet.isWordFromAuto(words[i]) == isFromAuto);
+    }
+    CHECK(AutoSerializer::serialize(loadedDet) == detBytes);
+
+    StreamMatcher<const SerializedAutomaton> matcher(serializedDet);
+    CHECK(matcher.feed("abab") == StreamMatcher<const SerializedAutomaton>::Status::Rejecting);
+    CHECK(matcher.feed("cca") == StreamMatcher<const SerializedAutomaton>::Status::Accepting);
+    CHECK(matcher.feed("x") == StreamMatcher<const SerializedAutomaton>::Status::Dead);
+
+    std::string wrongVersion = detBytes;
+    wrongVersion[4] = 2;
+    CHECK_THROWS_AS(SerializedAutomaton(std::string_view(wrongVersion)), std::invalid_argument);
+    std::string shortBytes = detBytes.substr(0, detBytes.size() - 1);
+    CHECK_THROWS_AS(SerializedAutomaton(std::string_view(shortBytes)), std::invalid_argument);
+    CHECK_THROWS_AS(AutoSerializer::serialize(DetermAutomaton()), std::out_of_range);
+}
+
+TEST_CASE("Test copying automatons with numbered nodes")
+{
+    DetermAutomaton a;
+    a.addFirstNode("A");
+    a.addTransition("A", 'a', "B");
+    a.addTransition("B", 'b', "A");
+    a.addFinals("B");
+    DetermAutomaton b(a);
+    a.addTransition("B", 'a', "C");
+    a.addFinals("C");
+
+    CHECK(a.isWordFromAuto("aba"));
+    CHECK(a.isWordFromAuto("aa"));
+    CHECK(!b.isWordFromAuto("aa"));
+    CHECK(*b.begin() == "A");
+    CHECK(*b.begin().transition('a', b) == "B");
+    CHECK(!b.isUnique("B"));
+    CHECK(b.isUnique("C"));
+
+    std::stringstream out;
+    b.visualize(out);
+    CHECK(out.str() == "Automat\nFirst: A\nA (a, B)  \nB (b, A)  \nFinals: B \n");
+
+    NondetermAutomaton word("ab");
+    NondetermAutomaton copy;
+    copy = word;
+    CHECK(copy.isWordFromAuto("ab"));
+    CHECK(*copy.begin() == std::vector<std::string>{"ab0"});
+    CHECK(*copy.end() == std::vector<std::string>{"ab2"});
+}
+
+TEST_CASE("Test moving automatons")
+{
+    DetermAutomaton a;
+    a.addFirstNode("A");
+    a.addTransition("A", 'a', "B");
+    a.addFinals("B");
+    DetermAutomaton b(std::move(a));
+    CHECK(a.isEmpty());
+    CHECK(b.isWordFromAuto("a"));
+    a = std::move(b);
+    CHECK(b.isEmpty());
+    CHECK(a.isWordFromAuto("a"));
+    CHECK(!a.isUnique("B"));
+
+    NondetermAutomaton word("ab");
+    NondetermAutomaton moved;
+    moved = std::move(word);
+    CHECK(word.isEmpty());
+    CHECK(moved.isWordFromAuto("ab"));
+    word = NondetermAutomaton::kleeneStar(moved);
+    CHECK(word.isWordFromAuto("abab"));
+    CHECK(!word.isWordFromAuto("aba"));
+}
+
+TEST_CASE("Test final states of automatons")
+{
+    DetermAutomaton a;
+    a.addFirstNode("A");
+    a.addTransition("A", 'a', "B");
+    a.addTransition("B", 'a', "C");
+    a.addFinals("C");
+    a.addFinals("A");
+    a.addFinals("C");
+    CHECK(a.end().size() == 2);
+    CHECK(a.begin().isFinal());
+    CHECK(!a.begin().transition('a', a).isFinal());
+    CHECK(!a.out().isFinal());
+
+    DetermAutomaton complement = a.complementation();
+    CHECK(complement.isWordFromAuto("a"));
+    CHECK(!complement.isWordFromAuto("aa"));
+    CHECK(complement.end().size() == 1);
+
+    NondetermAutomaton word("ab");
+    NondetermAutomaton united = NondetermAutomaton::unions(word, NondetermAutomaton("@"));
+    CHECK(united.isWordFromAuto(""));
+    CHECK(united.isWordFromAuto("ab"));
+    CHECK((*united.end()).size() == 2);
+    NondetermAutomaton joined = NondetermAutomaton::concatenation(word, united);
+    CHECK(joined.isWordFromAuto("ab"));
+    CHECK(joined.isWordFromAuto("abab"));
+    CHECK(!joined.isWordFromAuto(""));
+    CHECK((*joined.end()).size() == 2);
+}
+
+TEST_CASE("Test building automatons in bulk")
+{
+    AutoBuilder builder(3);
+    builder.setFirst(0);
+    builder.addFinal(2);
+    builder.addTransitions({{0, 'a', 1}, {1, 'b', 2}, {0, 'a', 1}, {2, 'a', 1}});
+    builder.addTransition(1, 'b', 2);
+    CHECK(builder.getTransitionsCount() == 5);
+    builder.freeze();
+    CHECK(builder.getTransitionsCount() == 3);
+    CHECK_THROWS_AS(builder.addTransition(0, 'b', 2), std::invalid_argument);
+
+    DetermAutomaton determ = builder.toDetermAutomaton();
+    CHECK(*determ.begin() == "q0");
+    CHECK(determ.isWordFromAuto("abab"));
+    CHECK(!determ.isWordFromAuto("aba"));
+    CHECK(!determ.isUnique("q2"));
+
+    AutoBuilder nondetermBuilder(2);
+    nondetermBuilder.setFirst(0);
+    nondetermBuilder.addFinal(1);
+    nondetermBuilder.addTransition(0, 'a', 0);
+    nondetermBuilder.addTransition(0, 'a', 1);
+    nondetermBuilder.addEpsilonTransition(1, 0);
+    CHECK_THROWS_AS(nondetermBuilder.addTransition(0, 'a', 2), std::out_of_range);
+    NondetermAutomaton nondeterm = nondetermBuilder.toNondetermAutomaton();
+    CHECK(nondeterm.isWordFromAuto("aaa"));
+    CHECK(!nondeterm.isWordFromAuto(""));
+    CHECK_THROWS_AS(nondetermBuilder.toDetermAutomaton(), std::invalid_argument);
+    CHECK_THROWS_AS(AutoBuilder(1).toDetermAutomaton(), std::out_of_range);
+}
+
+TEST_CASE("Test unique names of joined automatons")
+{
+    NondetermAutomaton word("a");
+    NondetermAutomaton united = NondetermAutomaton::unions(word, word);
+    std::stringstream out;
+    united.visualize(out);
+    CHECK(out.str() == "Automat\nFirst: unique\na0 (a, a1)  \na1  \na0#2 (a, a1#3)  \na1#3  \nunique (epsilon, a0) (epsilon, a0#2)  \nFinals: a1 a1#3 \n");
+    CHECK(!united.isUnique("a0"));
+    CHECK(!united.isUnique("a0#2"));
+    CHECK(united.isUnique("a0#3"));
+
+    NondetermAutomaton other("b");
+    NondetermAutomaton joined = NondetermAutomaton::concatenation(word, other);
+    CHECK(*joined.begin() == std::vector<std::string>{"a0"});
+    CHECK(*joined.end() == std::vector<std::string>{"b1"});
+    CHECK(!joined.isUnique("b0"));
+
+    NondetermAutomaton epsilon("@");
+    NondetermAutomaton twice = NondetermAutomaton::concatenation(epsilon, epsilon);
+    CHECK(*twice.end() == std::vector<std::string>{"epsilonNode#1"});
+    CHECK(twice.isWordFromAuto(""));
+    NondetermAutomaton fourTimes = NondetermAutomaton::concatenation(twice, twice);
+    CHECK(*fourTimes.end() == std::vector<std::string>{"epsilonNode#1#3"});
+    CHECK(!fourTimes.isUnique("epsilonNode#2"));
+
+    NondetermAutomaton numbered;
+    numbered.addFirstNode("a0");
+    numbered.addTransition("a0", 'b', "a0#2");
+    numbered.addFinals("a0#2");
+    NondetermAutomaton numberedJoined = NondetermAutomaton::concatenation(word, numbered);
+    CHECK(numberedJoined.isWordFromAuto("ab"));
+    CHECK(*numberedJoined.end() == std::vector<std::string>{"a0#2"});
+    CHECK(!numberedJoined.isUnique("a0#3"));
+    numberedJoined.addTransition("a0#3", 'c', "a0#2");
+    CHECK(numberedJoined.isWordFromAuto("ac"));
+    CHECK(*numbered.begin() == std::vector<std::string>{"a0"});
+    CHECK(numbered.isWordFromAuto("b"));
+}
+
+TEST_CASE("Test names of nested products")
+{
+    DetermAutomaton a;
+    a.addFirstNode("A");
+    a.addTransition("A", 'a', "B");
+    a.addFinals("B");
+    DetermAutomaton b;
+    b.addFirstNode("X");
+    b.addTransition("X", 'a', "Y");
+    b.addTransition("X", 'b', "Y");
+    b.addFinals("Y");
+
+    DetermAutomaton product = DetermAutomaton::intersection(a, b);
+    CHECK(*product.begin() == "(A,X)");
+    CHECK(*product.begin().transition('a', product) == "(B,Y)");
+    CHECK(!product.isUnique("(A,X)"));
+    CHECK(product.isUnique("(A,Y)"));
+
+    DetermAutomaton nested = DetermAutomaton::unions(product, b);
+    CHECK(*nested.begin() == "((A,X),X)");
+    CHECK(*nested.begin().transition('b', nested) == "(,Y)");
+    for (int i = 0; i < 20; ++i)
+    {
+        nested = DetermAutomaton::intersection(nested, nested);
+    }
+    CHECK(nested.isWordFromAuto("a"));
+    CHECK(nested.isWordFromAuto("b"));
+    CHECK(!nested.isWordFromAuto("ab"));
+
+    NondetermAutomaton word("a");
+    NondetermAutomaton chain = NondetermAutomaton::intersection(word, word);
+    CHECK(*chain.begin() == std::vector<std::string>{"(a0,a0)"});
+    for (int i = 0; i < 20; ++i)
+    {
+        chain = NondetermAutomaton::unions(chain, word);
+    }
+    CHECK(chain.isWordFromAuto("a"));
+    CHECK(!chain.isWordFromAuto("aa"));
+
+    product.addFinals("(A,X)");
+    product.addTransition("(B,Y)", 'b', "(A,X)");
+    CHECK(product.isWordFromAuto(""));
+    CHECK(product.isWordFromAuto("aba"));
+    CHECK(!product.isUnique("(B,Y)"));
+    CHECK_THROWS_AS(product.addFinals("(B,X)"), std::invalid_argument);
+
+    NondetermAutomaton pair = NondetermAutomaton::intersection(word, word);
+    pair.addTransition("(a1,a1)", 'b', "(a0,a0)");
+    pair.addFinals("(a0,a0)");
+    CHECK(pair.isWordFromAuto("abab"));
+    CHECK(pair.isUnique("(a0,a2)"));
+}
+
 TEST_CASE("Test parsing an auto to a regular expression ")
 {
 
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <stdexcept>
+#include "autoBuilder.h"
+
+bool AutoBuilder::Transition::operator<(const Transition &other) const
+{
+    return std::tie(from, symbol, to) < std::tie(other.from, other.symbol, other.to);
+}
+
+bool AutoBuilder::Transition::operator==(const Transition &other) const
+{
+    return from == other.from && symbol == other.symbol && to == other.to;
+}
+
+AutoBuilder::AutoBuilder(int statesCount) : first{NO_STATE}, finals(statesCount, false), isFrozen{false}
+{
+    if (statesCount < 0)
+    {
+        throw std::invalid_argument("Negative number of states");
+    }
+}
+
+int AutoBuilder::addState()
+{
+    if (isFrozen)
+    {
+        throw std::invalid_argument("The builder is frozen");
+    }
+    finals.push_back(false);
+    return finals.size() - 1;
+}
+
+int AutoBuilder::getStatesCount() const
+{
+    return finals.size();
+}
+
+int AutoBuilder::getTransitionsCount() const
+{
+    return transitions.size();
+}
+
+void AutoBuilder::checkState(int state) const
+{
+    if (state < 0 || state >= finals.size())
+    {
+        throw std::out_of_range("No such state");
+    }
+}
+
+void AutoBuilder::checkTransition(int from, int to) const
+{
+    if (isFrozen)
+    {
+        throw std::invalid_argument("The builder is frozen");
+    }
+    checkState(from);
+    checkState(to);
+}
+
+void AutoBuilder::setFirst(int state)
+{
+    checkState(state);
+    first = state;
+}
+
+void AutoBuilder::addFinal(int state)
+{
+    checkState(state);
+    finals[state] = true;
+}
+
+void AutoBuilder::reserve(int transitionsCount)
+{
+    transitions.reserve(transitionsCount);
+}
+
+void AutoBuilder::addTransition(int from, const char &transitionChar, int to)
+{
+    checkTransition(from, to);
+    transitions.push_back(Transition{from, (unsigned char)transitionChar, to});
+}
+
+void AutoBuilder::addEpsilonTransition(int from, int to)
+{
+    checkTransition(from, to);
+    transitions.push_back(Transition{from, EPSILON, to});
+}
+
+void AutoBuilder::addTransitions(const std::vector<std::tuple<int, char, int>> &newTransitions)
+{
+    transitions.reserve(transitions.size() + newTransitions.size());
+    for (int i = 0; i < newTransitions.size(); ++i)
+    {
+        addTransition(std::get<0>(newTransitions[i]), std::get<1>(newTransitions[i]), std::get<2>(newTransitions[i]));
+    }
+}
+
+void AutoBuilder::freeze()
+{
+    if (isFrozen)
+    {
+        return;
+    }
+    std::sort(transitions.begin(), transitions.end());
+    transitions.erase(std::unique(transitions.begin(), transitions.end()), transitions.end());
+    transitions.shrink_to_fit();
+    isFrozen = true;
+}
+
+std::string AutoBuilder::stateName(int state)
+{
+    return "q" + std::to_string(state);
+}
+
+DetermAutomaton AutoBuilder::toDetermAutomaton()
+{
+    if (first == NO_STATE)
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    freeze();
+    DetermAutomaton myAuto;
+    for (int i = 0; i < finals.size(); ++i)
+    {
+        myAuto.addNode(stateName(i));
+    }
+    myAuto.first = first;
+    // the transitions are sorted, so a repeated char of a state is next to the first one
+    for (int i = 0; i < transitions.size(); ++i)
+    {
+        if (transitions[i].symbol == EPSILON)
+        {
+            throw std::invalid_argument("Epsilon transition in a deterministic automaton");
+        }
+        if (i > 0 && transitions[i - 1].from == transitions[i].from && transitions[i - 1].symbol == transitions[i].symbol)
+        {
+            throw std::invalid_argument("Nondeterministic actions");
+        }
+        myAuto.nodes[transitions[i].from].append((char)transitions[i].symbol, transitions[i].to);
+    }
+    for (int i = 0; i < finals.size(); ++i)
+    {
+        if (finals[i])
+        {
+            myAuto.addFinalNode(i);
+        }
+    }
+    return myAuto;
+}
+
+NondetermAutomaton AutoBuilder::toNondetermAutomaton()
+{
+    if (first == NO_STATE)
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    freeze();
+    NondetermAutomaton myAuto;
+    for (int i = 0; i < finals.size(); ++i)
+    {
+        myAuto.addNode(stateName(i));
+    }
+    myAuto.first = first;
+    for (int i = 0; i < transitions.size(); ++i)
+    {
+        std::optional<char> symbol;
+        if (transitions[i].symbol != EPSILON)
+        {
+            symbol = (char)transitions[i].symbol;
+        }
+        myAuto.nodes[transitions[i].from].append(symbol, transitions[i].to);
+    }
+    myAuto.finals = finals;
+    return myAuto;
+}
@@ -0,0 +1,76 @@
+#ifndef AUTO_BUILDER_H
+#define AUTO_BUILDER_H
+#include <string>
+#include <tuple>
+#include <vector>
+#include "../Deterministic/determAuto.h"
+#include "nondetermAuto.h"
+
+///class AutoBuilder collects the transitions between numbered states in bulk and freezes them to an automaton,
+///the states are named q0, q1, ... in the automaton
+class AutoBuilder
+{
+    ///marks an epsilon transition, the chars are kept as unsigned values
+    static constexpr int EPSILON = 256;
+    static constexpr int NO_STATE = -1;
+
+    struct Transition
+    {
+        int from;
+        int symbol;
+        int to;
+
+        bool operator<(const Transition &) const;
+
+        bool operator==(const Transition &) const;
+    };
+
+    int first;
+    std::vector<bool> finals;
+    std::vector<Transition> transitions;
+    bool isFrozen;
+
+    ///throws if the builder is frozen or there is no such state
+    void checkTransition(int from, int to) const;
+
+    void checkState(int) const;
+
+    ///returns the name of the state in the built automaton
+    static std::string stateName(int);
+
+public:
+    AutoBuilder(int statesCount = 0);
+
+    ///adds a state and returns its number
+    int addState();
+
+    int getStatesCount() const;
+
+    ///returns the number of transitions, after freeze() the repeated ones are not counted
+    int getTransitionsCount() const;
+
+    void setFirst(int);
+
+    void addFinal(int);
+
+    ///reserves memory for the number of transitions
+    void reserve(int);
+
+    void addTransition(int from, const char &, int to);
+
+    void addEpsilonTransition(int from, int to);
+
+    ///adds all transitions from the list of (from, char, to)
+    void addTransitions(const std::vector<std::tuple<int, char, int>> &);
+
+    ///sorts the transitions and removes the repeated ones in one pass, no transitions can be added after it
+    void freeze();
+
+    ///freezes the builder and returns a deterministic automaton, throws if there are epsilon or nondeterministic transitions
+    DetermAutomaton toDetermAutomaton();
+
+    ///freezes the builder and returns a nondeterministic automaton
+    NondetermAutomaton toNondetermAutomaton();
+};
+
+#endif
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <stdexcept>
+#include "bitsetNondetermAuto.h"
+
+BitsetNondetermAutomaton::BitsetNondetermAutomaton(const NondetermAutomaton &myAuto)
+{
+    if (myAuto.isEmpty())
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    std::vector<std::vector<std::pair<std::optional<char>, int>>> transitions;
+    myAuto.listTransitions(transitions);
+    std::vector<StateSet> closures = NondetermAutomaton::buildEpsilonClosures(transitions);
+    size = transitions.size();
+    wordsCount = (size + 63) / 64;
+
+    ByteClasses byteClasses = NondetermAutomaton::buildByteClasses(transitions);
+    classes = byteClasses.getClasses();
+
+    classesCount = byteClasses.getClassesCount();
+    if ((long long)classesCount * size * wordsCount <= MAX_MASKS_SIZE)
+    {
+        masks.assign(classesCount * size * wordsCount, 0);
+    }
+    successorStarts.push_back(0);
+    for (int state = 0; state < size; ++state)
+    {
+        // the class and the state of every successor, sorted to join the closures of the transitions of a class
+        std::vector<std::pair<int, int>> stateSuccessors;
+        for (int k = 0; k < transitions[state].size(); ++k)
+        {
+            if (!transitions[state][k].first)
+            {
+                continue;
+            }
+            int symbol = classes[(unsigned char)*transitions[state][k].first];
+            std::vector<int> members = closures[transitions[state][k].second].getMembers();
+            for (int i = 0; i < members.size(); ++i)
+            {
+                stateSuccessors.push_back(std::pair(symbol, members[i]));
+            }
+        }
+        if (!masks.empty())
+        {
+            for (int i = 0; i < stateSuccessors.size(); ++i)
+            {
+                int member = stateSuccessors[i].second;
+                masks[(stateSuccessors[i].first * size + state) * wordsCount + member / 64] |= std::uint64_t(1) << (member % 64);
+            }
+            continue;
+        }
+        std::sort(stateSuccessors.begin(), stateSuccessors.end());
+        stateSuccessors.erase(std::unique(stateSuccessors.begin(), stateSuccessors.end()), stateSuccessors.end());
+        int current = 0;
+        for (int symbol = 0; symbol < classesCount; ++symbol)
+        {
+            for (; current < stateSuccessors.size() && stateSuccessors[current].first == symbol; ++current)
+            {
+                successors.push_back(stateSuccessors[current].second);
+            }
+            successorStarts.push_back(successors.size());
+        }
+    }
+
+    std::vector<int> members = closures[myAuto.first].getMembers();
+    firstMask.assign(wordsCount, 0);
+    for (int i = 0; i < members.size(); ++i)
+    {
+        firstMask[members[i] / 64] |= std::uint64_t(1) << (members[i] % 64);
+    }
+    finalMask.assign(wordsCount, 0);
+    for (int state = 0; state < myAuto.nodes.size(); ++state)
+    {
+        if (myAuto.finals[state])
+        {
+            finalMask[state / 64] |= std::uint64_t(1) << (state % 64);
+        }
+    }
+}
+
+bool BitsetNondetermAutomaton::isWordFromAuto(std::string_view transitionWord) const
+{
+    if (masks.empty())
+    {
+        return isWordFromSparseAuto(transitionWord);
+    }
+    if (wordsCount == 1)
+    {
+        return isWordFromSmallAuto(transitionWord);
+    }
+    std::vector<std::uint64_t> current(firstMask), next(wordsCount);
+    for (int i = 0; i < transitionWord.size(); ++i)
+    {
+        int symbol = classes[(unsigned char)transitionWord[i]];
+        std::fill(next.begin(), next.end(), 0);
+        for (int w = 0; w < wordsCount; ++w)
+        {
+            std::uint64_t word = current[w];
+            while (word)
+            {
+                const std::uint64_t *mask = &masks[(symbol * size + w * 64 + __builtin_ctzll(word)) * wordsCount];
+                for (int k = 0; k < wordsCount; ++k)
+                {
+                    next[k] |= mask[k];
+                }
+                word &= word - 1;
+            }
+        }
+        bool isEmpty = true;
+        for (int k = 0; k < wordsCount && isEmpty; ++k)
+        {
+            isEmpty = !next[k];
+        }
+        if (isEmpty)
+        {
+            return false;
+        }
+        current.swap(next);
+    }
+    for (int w = 0; w < wordsCount; ++w)
+    {
+        if (current[w] & finalMask[w])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BitsetNondetermAutomaton::isWordFromSmallAuto(std::string_view transitionWord) const
+{
+    const std::uint64_t *smallMasks = masks.data();
+    std::uint64_t current = firstMask[0];
+    for (int i = 0; i < transitionWord.size() && current; ++i)
+    {
+        int symbol = classes[(unsigned char)transitionWord[i]];
+        const std::uint64_t *symbolMasks = smallMasks + symbol * size;
+        std::uint64_t next = 0;
+        while (current)
+        {
+            next |= symbolMasks[__builtin_ctzll(current)];
+            current &= current - 1;
+        }
+        current = next;
+    }
+    return current & finalMask[0];
+}
+
+bool BitsetNondetermAutomaton::isWordFromSparseAuto(std::string_view transitionWord) const
+{
+    std::vector<std::uint64_t> current(firstMask), next(wordsCount);
+    for (int i = 0; i < transitionWord.size(); ++i)
+    {
+        int symbol = classes[(unsigned char)transitionWord[i]];
+        std::fill(next.begin(), next.end(), 0);
+        bool isEmpty = true;
+        for (int w = 0; w < wordsCount; ++w)
+        {
+            std::uint64_t word = current[w];
+            while (word)
+            {
+                int index = (w * 64 + __builtin_ctzll(word)) * classesCount + symbol;
+                for (int k = successorStarts[index]; k < successorStarts[index + 1]; ++k)
+                {
+                    next[successors[k] / 64] |= std::uint64_t(1) << (successors[k] % 64);
+                    isEmpty = false;
+                }
+                word &= word - 1;
+            }
+        }
+        if (isEmpty)
+        {
+            return false;
+        }
+        current.swap(next);
+    }
+    for (int w = 0; w < wordsCount; ++w)
+    {
+        if (current[w] & finalMask[w])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int BitsetNondetermAutomaton::getStatesCount() const
+{
+    return size;
+}
+
+bool BitsetNondetermAutomaton::hasDenseMasks() const
+{
+    return !masks.empty();
+}
@@ -0,0 +1,49 @@
+#ifndef BITSET_NONDETERMINISTIC_AUTOMATON_H
+#define BITSET_NONDETERMINISTIC_AUTOMATON_H
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "nondetermAuto.h"
+
+///class BitsetNondetermAutomaton simulates a nondeterministic automaton with the active states kept as a bitset
+class BitsetNondetermAutomaton
+{
+    ///the most words of masks, the masks of bigger autos would take classes * size * size / 8 bytes
+    static constexpr int MAX_MASKS_SIZE = 1 << 21;
+
+    int size;
+    int wordsCount;
+    int classesCount;
+    ///the class of every char, there are masks for every class
+    std::vector<unsigned char> classes;
+    ///the states reachable from a state with a char class and epsilon transitions, wordsCount words per mask
+    std::vector<std::uint64_t> masks;
+    ///without masks the same states are from successorStarts[state * classesCount + class] to the next start
+    std::vector<int> successorStarts;
+    std::vector<int> successors;
+    std::vector<std::uint64_t> firstMask;
+    std::vector<std::uint64_t> finalMask;
+
+    ///matches the word when all states fit in a single word
+    bool isWordFromSmallAuto(std::string_view) const;
+
+    ///matches the word with the lists of successors
+    bool isWordFromSparseAuto(std::string_view) const;
+
+public:
+    BitsetNondetermAutomaton() = delete;
+
+    BitsetNondetermAutomaton(const NondetermAutomaton &);
+
+    ///checks whether the word is from the language of the auto
+    bool isWordFromAuto(std::string_view) const;
+
+    ///returns the number of states of the auto
+    int getStatesCount() const;
+
+    ///checks whether the transitions are kept as masks or as lists of successors of the states
+    bool hasDenseMasks() const;
+};
+
+#endif
@@ -0,0 +1,158 @@
+#include <stdexcept>
+#include "lazyDetermAuto.h"
+
+LazyDetermAutomaton::LazyDetermAutomaton(const NondetermAutomaton &myAuto, int _maxStates) : maxStates{_maxStates}
+{
+    if (myAuto.isEmpty())
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    if (maxStates < 4)
+    {
+        throw std::invalid_argument("The cache must hold at least 4 states");
+    }
+    myAuto.listTransitions(transitions);
+    closures = NondetermAutomaton::buildEpsilonClosures(transitions);
+    ByteClasses byteClasses = NondetermAutomaton::buildByteClasses(transitions);
+    classes = byteClasses.getClasses();
+    classesCount = byteClasses.getClassesCount();
+    size = transitions.size();
+
+    finalStates = StateSet(size);
+    for (int i = 0; i < size; ++i)
+    {
+        if (myAuto.finals[i])
+        {
+            finalStates.add(i);
+        }
+    }
+
+    // the states from which no final state is reached are left out of the closures,
+    // so a set of states from which no word is accepted is the empty dead state
+    std::vector<std::vector<int>> previous(size);
+    for (int i = 0; i < size; ++i)
+    {
+        for (int k = 0; k < transitions[i].size(); ++k)
+        {
+            previous[transitions[i][k].second].push_back(i);
+        }
+    }
+    StateSet liveStates(finalStates);
+    std::vector<int> listOfStates = finalStates.getMembers();
+    for (int i = 0; i < listOfStates.size(); ++i)
+    {
+        const std::vector<int> &states = previous[listOfStates[i]];
+        for (int k = 0; k < states.size(); ++k)
+        {
+            if (liveStates.add(states[k]))
+            {
+                listOfStates.push_back(states[k]);
+            }
+        }
+    }
+    for (int i = 0; i < size; ++i)
+    {
+        StateSet liveClosure(size);
+        std::vector<int> members = closures[i].getMembers();
+        for (int k = 0; k < members.size(); ++k)
+        {
+            if (liveStates.contains(members[k]))
+            {
+                liveClosure.add(members[k]);
+            }
+        }
+        closures[i] = liveClosure;
+    }
+    firstStates = closures[myAuto.first];
+    clearCache();
+}
+
+int LazyDetermAutomaton::addState(const StateSet &newState)
+{
+    auto found = stateIndices.find(newState);
+    if (found != stateIndices.end())
+    {
+        return found->second;
+    }
+    int index = states.size();
+    states.push_back(newState);
+    stateIndices[newState] = index;
+    table.resize(table.size() + classesCount, UNKNOWN_STATE);
+    finals.push_back(newState.intersects(finalStates));
+    return index;
+}
+
+void LazyDetermAutomaton::clearCache()
+{
+    states.clear();
+    stateIndices.clear();
+    table.clear();
+    finals.clear();
+    addState(StateSet(size));
+    firstState = addState(firstStates);
+}
+
+bool LazyDetermAutomaton::isWordFromAuto(std::string_view transitionWord)
+{
+    int state = firstState;
+    for (int i = 0; i < transitionWord.size() && state != DEAD_STATE; ++i)
+    {
+        int next = table[state * classesCount + classes[(unsigned char)transitionWord[i]]];
+        state = (next != UNKNOWN_STATE) ? next : transition(state, transitionWord[i]);
+    }
+    return finals[state];
+}
+
+int LazyDetermAutomaton::begin() const
+{
+    return firstState;
+}
+
+int LazyDetermAutomaton::transition(int state, const char &transitionChar)
+{
+    int cell = state * classesCount + classes[(unsigned char)transitionChar];
+    if (table[cell] != UNKNOWN_STATE)
+    {
+        return table[cell];
+    }
+
+    StateSet next(size);
+    std::vector<int> members = states[state].getMembers();
+    for (int i = 0; i < members.size(); ++i)
+    {
+        const std::vector<std::pair<std::optional<char>, int>> &nexts = transitions[members[i]];
+        for (int k = 0; k < nexts.size(); ++k)
+        {
+            if (nexts[k].first && *nexts[k].first == transitionChar)
+            {
+                next.unite(closures[nexts[k].second]);
+            }
+        }
+    }
+
+    if (stateIndices.count(next) == 0 && states.size() >= maxStates)
+    {
+        StateSet current = states[state];
+        clearCache();
+        state = addState(current);
+        cell = state * classesCount + classes[(unsigned char)transitionChar];
+    }
+    int nextState = addState(next);
+    table[cell] = nextState;
+    return nextState;
+}
+
+bool LazyDetermAutomaton::isFinalState(int state) const
+{
+    return finals[state];
+}
+
+bool LazyDetermAutomaton::isDeadState(int state) const
+{
+    return state == DEAD_STATE;
+}
+
+int LazyDetermAutomaton::getCachedStatesCount() const
+{
+    return states.size();
+}
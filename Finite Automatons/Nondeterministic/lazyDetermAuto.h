@@ -0,0 +1,68 @@
+#ifndef LAZY_DETERMINISTIC_AUTOMATON_H
+#define LAZY_DETERMINISTIC_AUTOMATON_H
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <optional>
+#include "stateSet.h"
+#include "nondetermAuto.h"
+
+///class LazyDetermAutomaton matches words of a nondeterministic automaton by building deterministic states on demand
+class LazyDetermAutomaton
+{
+    ///marks a transition which is not computed yet
+    static constexpr int UNKNOWN_STATE = -1;
+
+    ///the empty set of states is always state 0
+    static constexpr int DEAD_STATE = 0;
+
+
+    int size;
+    int maxStates;
+    int classesCount;
+    ///the class of every char, the table has a column for every class
+    std::vector<unsigned char> classes;
+    std::vector<std::vector<std::pair<std::optional<char>, int>>> transitions;
+    std::vector<StateSet> closures;
+    StateSet finalStates;
+    StateSet firstStates;
+
+    std::vector<StateSet> states;
+    std::unordered_map<StateSet, int, StateSetHash> stateIndices;
+    std::vector<int> table;
+    std::vector<char> finals;
+    ///the epsilon closure of the first node is state 1 or the dead state if no final state is reached from it
+    int firstState;
+
+    ///returns the index of the set of states and adds it if it is missing
+    int addState(const StateSet &);
+
+    ///removes all cached states except the dead and the first one
+    void clearCache();
+
+public:
+    LazyDetermAutomaton() = delete;
+
+    ///the cache is cleared when it reaches maxStates states
+    LazyDetermAutomaton(const NondetermAutomaton &, int maxStates = 10000);
+
+    ///checks whether the word is from the language of the auto
+    bool isWordFromAuto(std::string_view);
+
+    ///returns the starting state
+    int begin() const;
+
+    ///returns the state reached from the state with the char and caches the transition
+    int transition(int state, const char &transitionChar);
+
+    bool isFinalState(int state) const;
+
+    ///checks whether the state has no active nondeterministic states from which a final state is reached
+    bool isDeadState(int state) const;
+
+    ///returns the number of cached deterministic states
+    int getCachedStatesCount() const;
+};
+
+#endif
@@ -3,82 +3,41 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <unordered_set>
 #include <string>
-#include <time.h>
 #include <utility>
 #include <exception>
 #include <cstring>
+#include <type_traits>
 #include "nondetermAuto.h"
+#include "autoBuilder.h"
 
-void NondetermAutomaton::Node::copy(const NondetermAutomaton::Node &other)
-{
-    this->nodeName = other.nodeName;
-    this->next.clear();
-}
-
-NondetermAutomaton::Node::Node(const Node &other)
-{
-    copy(other);
-}
-
-typename NondetermAutomaton::Node &NondetermAutomaton::Node::operator=(const Node &other)
-{
-    if (this != &other)
-    {
-        copy(other);
-    }
-    return *this;
-}
-
-std::string NondetermAutomaton::Node::getNodeName() const
-{
-    return nodeName;
-}
-
-std::vector<std::pair<std::optional<char>, const NondetermAutomaton::Node *>> NondetermAutomaton::Node::getNext() const
+const std::vector<std::pair<std::optional<char>, int>> &NondetermAutomaton::Node::getNext() const
 {
     return next;
 }
 
-void NondetermAutomaton::Node::add(std::optional<char> transitionChar, const Node *node)
+bool NondetermAutomaton::Node::add(std::optional<char> transitionChar, int node)
 {
-    if (node->isNodeFromTransitionList(this->hasSymbolTransition(transitionChar)))
-    {
-        throw std::overflow_error("There is already the same transition.\n");
-    }
-    else
-    {
-        if (transitionChar)
-        {
-            next.push_back(std::pair<std::optional<char>, const Node *>(transitionChar, node));
-        }
-        else
-        {
-            next.push_back(std::pair<std::optional<char>, const Node *>(std::nullopt, node));
-        }
-    }
-}
-
-bool NondetermAutomaton::Node::isNodeFromTransitionList(std::vector<Node const *> nodes) const
-{
-    for (int i = 0; i < nodes.size(); ++i)
+    for (int i = 0; i < next.size(); ++i)
     {
-        if (this == nodes[i])
+        if (next[i].second == node && equalChars(next[i].first, transitionChar))
         {
-            return true;
+            return false;
         }
     }
-    return false;
+    next.push_back(std::pair<std::optional<char>, int>(transitionChar, node));
+    return true;
 }
 
-void NondetermAutomaton::Node::pushBackToName(const std::string &symbols)
+void NondetermAutomaton::Node::append(std::optional<char> transitionChar, int node)
 {
-    nodeName.append(symbols);
+    next.push_back(std::pair<std::optional<char>, int>(transitionChar, node));
 }
 
-typename std::vector<NondetermAutomaton::Node const *> NondetermAutomaton::Node::hasSymbolTransition(std::optional<char> transitionChar) const
+std::vector<int> NondetermAutomaton::Node::hasSymbolTransition(std::optional<char> transitionChar) const
 {
-    std::vector<NondetermAutomaton::Node const *> nextState;
+    std::vector<int> nextState;
 
     for (int i = 0; i < next.size(); ++i)
     {
@@ -90,27 +49,20 @@ typename std::vector<NondetermAutomaton::Node const *> NondetermAutomaton::Node:
     return nextState;
 }
 
- 
-
 void NondetermAutomaton::AutoIterator::copy(const AutoIterator &other)
 {
-    current.clear();
-    for (int i = 0; i < other.current.size(); ++i)
-    {
-        current.push_back(other.current[i]);
-    }
+    automaton = other.automaton;
+    current = other.current;
 }
 
-NondetermAutomaton::AutoIterator::AutoIterator(NondetermAutomaton::Node *node) { current.push_back(node); }
-
-NondetermAutomaton::AutoIterator::AutoIterator(std::vector<Node *> nodes)
+NondetermAutomaton::AutoIterator::AutoIterator(const NondetermAutomaton *_automaton, int node) : automaton{_automaton}
 {
-    for (int i = 0; i < nodes.size(); ++i)
-    {
-        current.push_back(nodes[i]);
-    }
+    current.push_back(node);
 }
 
+NondetermAutomaton::AutoIterator::AutoIterator(const NondetermAutomaton *_automaton, const std::vector<int> &nodes)
+    : automaton{_automaton}, current{nodes} {}
+
 NondetermAutomaton::AutoIterator &NondetermAutomaton::AutoIterator::operator=(const AutoIterator &other)
 {
     if (this != &other)
@@ -166,11 +118,23 @@ std::vector<std::string> NondetermAutomaton::AutoIterator::operator*()
     std::vector<std::string> nodesNames;
     for (int i = 0; i < current.size(); ++i)
     {
-        nodesNames.push_back(current[i]->getNodeName());
+        nodesNames.push_back(automaton->names[current[i]].toString());
     }
     return nodesNames;
 }
 
+bool NondetermAutomaton::AutoIterator::isFinal() const
+{
+    for (int i = 0; i < current.size(); ++i)
+    {
+        if (automaton->finals[current[i]])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 NondetermAutomaton::AutoIterator &NondetermAutomaton::AutoIterator::transition(const char transitionChar, const NondetermAutomaton &automaton)
 {
     if (this->current.empty())
@@ -178,7 +142,7 @@ NondetermAutomaton::AutoIterator &NondetermAutomaton::AutoIterator::transition(c
         throw std::out_of_range("nullptr");
     }
 
-    std::vector<const NondetermAutomaton::Node *> newNodes;
+    std::vector<int> newNodes;
 
     for (int i = 0; i < current.size(); ++i)
     {
@@ -197,16 +161,16 @@ NondetermAutomaton::AutoIterator &NondetermAutomaton::AutoIterator::transition(c
 }
 
 void NondetermAutomaton::AutoIterator::transitionHelper(const char &transitionChar, const NondetermAutomaton &automaton,
-                                                        std::vector<const NondetermAutomaton::Node *> &newNodes, const int &i)
+                                                        std::vector<int> &newNodes, const int &i)
 {
     std::optional<char> symbol(transitionChar);
-    std::vector<const NondetermAutomaton::Node *> currentVector = current[i]->hasSymbolTransition(symbol);
+    std::vector<int> currentVector = automaton.nodes[current[i]].hasSymbolTransition(symbol);
     for (int i = 0; i < currentVector.size(); ++i)
     {
         bool repetition = false;
         for (int k = 0; k < newNodes.size(); ++k)
         {
-            if ((currentVector[i]->getNodeName()).compare(newNodes[k]->getNodeName()) == 0)
+            if (currentVector[i] == newNodes[k])
             {
                 repetition = true;
             }
@@ -225,11 +189,11 @@ NondetermAutomaton::AutoIterator &NondetermAutomaton::AutoIterator ::epsilonTran
     {
         throw std::out_of_range("nullptr");
     }
-    std::vector<const NondetermAutomaton::Node *> newNodes;
+    std::vector<int> newNodes;
 
     for (int i = 0; i < current.size(); ++i)
     {
-        std::vector<const NondetermAutomaton::Node *> currentVector = current[i]->hasSymbolTransition(std::nullopt);
+        std::vector<int> currentVector = automaton.nodes[current[i]].hasSymbolTransition(std::nullopt);
         newNodes.push_back(current[i]);
         newNodes.insert(newNodes.end(), currentVector.begin(), currentVector.end());
     }
@@ -248,12 +212,12 @@ NondetermAutomaton::AutoIterator &NondetermAutomaton::AutoIterator ::epsilonTran
     return *this;
 }
 
-void NondetermAutomaton::AutoIterator ::epsilonTransitionHelper(const int &i, std::vector<const NondetermAutomaton::Node *> &newNodes)
+void NondetermAutomaton::AutoIterator ::epsilonTransitionHelper(const int &i, std::vector<int> &newNodes)
 {
     bool repetition = false;
     for (int k = 0; k < current.size(); ++k)
     {
-        if ((current[k]->getNodeName()).compare(newNodes[i]->getNodeName()) == 0)
+        if (current[k] == newNodes[i])
         {
             repetition = true;
         }
@@ -269,7 +233,7 @@ bool NondetermAutomaton::AutoIterator::hasEpsilonTransition()
 
     for (int i = 0; i < current.size(); ++i)
     {
-        if (!current[i]->hasSymbolTransition(std::nullopt).empty())
+        if (!automaton->nodes[current[i]].hasSymbolTransition(std::nullopt).empty())
         {
             return true;
         }
@@ -277,121 +241,150 @@ bool NondetermAutomaton::AutoIterator::hasEpsilonTransition()
     return false;
 }
 
-
-void NondetermAutomaton::deleteNodes()
+NondetermAutomaton::AutoIterator &NondetermAutomaton::AutoIterator::epsilonClosure(const NondetermAutomaton &automaton)
 {
-    first = nullptr;
-    for (auto i = nodes.begin();
-         i != nodes.end(); i++)
+    std::vector<bool> visited(automaton.nodes.size(), false);
+    std::vector<int> newNodes;
+    for (int i = 0; i < current.size(); ++i)
     {
-        delete (i->second);
+        const std::vector<int> &closure = automaton.getEpsilonClosure(current[i]);
+        for (int k = 0; k < closure.size(); ++k)
+        {
+            if (!visited[closure[k]])
+            {
+                visited[closure[k]] = true;
+                newNodes.push_back(closure[k]);
+            }
+        }
     }
-    nodes.clear();
-    finalNodes.clear();
+    current = newNodes;
+    return *this;
 }
 
-void NondetermAutomaton::copyTransitions(const NondetermAutomaton &other)
+const std::vector<int> &NondetermAutomaton::getEpsilonClosure(int node) const
 {
-    int size = other.nodes.size();
-    int previousSize = nodes.size();
-    std::vector<std::string> listOfNodes;
-    std::unordered_map<std::string, int> listOfIndices;
-    int counter = 0;
-
-    for (auto i = other.nodes.begin();
-         i != other.nodes.end(); i++)
+    if (epsilonClosures.size() != nodes.size())
     {
-        Node *node = new Node(i->second->getNodeName());
-        this->nodes[node->getNodeName()] = node;
-        listOfNodes.push_back(i->second->getNodeName());
-        listOfIndices[i->second->getNodeName()] = counter++;
+        epsilonClosures.assign(nodes.size(), std::vector<int>());
     }
-
-    std::vector<std::optional<char>> **adjacencyMatrix = new std::vector<std::optional<char>> *[size];
-    for (int i = 0; i < size; ++i)
+    std::vector<int> &closure = epsilonClosures[node];
+    if (!closure.empty())
     {
-        std::vector<std::optional<char>> *arr = new std::vector<std::optional<char>>[size];
-        adjacencyMatrix[i] = arr;
+        return closure;
     }
-
-    other.buildAdjencyMatrix(adjacencyMatrix, listOfNodes, listOfIndices, (previousSize > 0));
-
-    for (int rows = 0; rows < size; ++rows)
+    std::vector<bool> visited(nodes.size(), false);
+    closure.push_back(node);
+    visited[node] = true;
+    for (int i = 0; i < closure.size(); ++i)
     {
-        copyTransitionsHelper(size, adjacencyMatrix, rows, listOfNodes);
-    }
-    for (int i = 0; i < size; ++i)
-    {
-        delete adjacencyMatrix[i];
-    }
-    delete adjacencyMatrix;
-}
-
-void NondetermAutomaton::copyTransitionsHelper(const int &size, std::vector<std::optional<char>> **adjacencyMatrix,
-                                               const int &rows, const std::vector<std::string> &listOfNodes)
-{
-    for (int cols = 0; cols < size; ++cols)
-    {
-        for (int counter = 0; counter < adjacencyMatrix[rows][cols].size(); ++counter)
+        const std::vector<std::pair<std::optional<char>, int>> &nexts = nodes[closure[i]].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
         {
-            try
-            {
-                nodes[listOfNodes[rows]]->add(adjacencyMatrix[rows][cols][counter], nodes[listOfNodes[cols]]);
-            }
-            catch (std::overflow_error error)
+            if (!nexts[k].first && !visited[nexts[k].second])
             {
-                std::cout << error.what();
+                visited[nexts[k].second] = true;
+                closure.push_back(nexts[k].second);
             }
         }
     }
+    return closure;
 }
 
-void NondetermAutomaton::copyFinals(const NondetermAutomaton &other)
+void NondetermAutomaton::copy(const NondetermAutomaton &other)
+{
+    first = other.first;
+    nodes = other.nodes;
+    finals = other.finals;
+    names = other.names;
+    nameIndices = other.nameIndices;
+    indexedNodesCount = other.indexedNodesCount;
+    epsilonClosures = other.epsilonClosures;
+}
+
+void NondetermAutomaton::move(NondetermAutomaton &other) noexcept
+{
+    first = other.first;
+    nodes = std::move(other.nodes);
+    finals = std::move(other.finals);
+    names = std::move(other.names);
+    nameIndices = std::move(other.nameIndices);
+    indexedNodesCount = other.indexedNodesCount;
+    epsilonClosures = std::move(other.epsilonClosures);
+    other.first = NO_NODE;
+    other.nodes.clear();
+    other.finals.clear();
+    other.names.clear();
+    other.nameIndices.clear();
+    other.indexedNodesCount = 0;
+    other.epsilonClosures.clear();
+}
+
+int NondetermAutomaton::addNode(const StateName &nodeName)
 {
-    for (int i = 0; i < other.finalNodes.size(); ++i)
+    int index = nodes.size();
+    nodes.push_back(Node());
+    finals.push_back(false);
+    names.push_back(nodeName);
+    if (nodeName.isPlain())
     {
-        finalNodes.push_back(nodes[other.finalNodes[i]->getNodeName()]);
+        nameIndices[nodeName.toString()] = index;
     }
+    return index;
 }
 
-void NondetermAutomaton::copy(const NondetermAutomaton &other)
+int NondetermAutomaton::findNode(const std::string &nodeName) const
 {
-    deleteNodes();
-    copyTransitions(other);
-    first = nodes[other.first->getNodeName()];
-    copyFinals(other);
+    auto found = nameIndices.find(nodeName);
+    if (found != nameIndices.end())
+    {
+        return found->second;
+    }
+    for (; indexedNodesCount < names.size(); ++indexedNodesCount)
+    {
+        if (!names[indexedNodesCount].isPlain())
+        {
+            nameIndices.emplace(names[indexedNodesCount].toString(), indexedNodesCount);
+        }
+    }
+    found = nameIndices.find(nodeName);
+    return found == nameIndices.end() ? NO_NODE : found->second;
 }
 
-void NondetermAutomaton::buildAdjencyMatrix(std::vector<std::optional<char>> **adjacencyMatrix, std::vector<std::string> listOfNodes,
-                                            std::unordered_map<std::string, int> listOfIndices, bool isNew) const
+int NondetermAutomaton::appendNodes(const NondetermAutomaton &other)
 {
-    int size = nodes.size();
-    for (int rows = 0; rows < size; ++rows)
+    epsilonClosures.clear();
+    int offset = nodes.size();
+    for (int i = 0; i < other.nodes.size(); ++i)
     {
-        Node *s = (this->nodes.lower_bound(listOfNodes[rows]))->second;
-        std::vector<std::pair<std::optional<char>, const NondetermAutomaton::Node *>> nextStates;
-        if (!isNew)
+        if (findNode(other.names[i].toString()) == NO_NODE)
         {
-            nextStates = (this->nodes.at(listOfNodes[rows]))->getNext();
+            addNode(other.names[i]);
+            continue;
         }
-        else
+        // a repeated name gets the index of its node in the joined auto,
+        // the next numbers are tried while the new name is a name of a node of one of the autos
+        StateName uniqueName = other.names[i];
+        for (int number = offset + i; findNode(uniqueName.toString()) != NO_NODE || other.findNode(uniqueName.toString()) != NO_NODE; ++number)
         {
-            nextStates = s->getNext();
+            uniqueName = StateName::withSuffix(other.names[i], "#" + std::to_string(number));
         }
-
-        for (int k = 0; k < nextStates.size(); ++k)
+        nameIndices.emplace(uniqueName.toString(), addNode(uniqueName));
+    }
+    std::copy(other.finals.begin(), other.finals.end(), finals.begin() + offset);
+    for (int i = 0; i < other.nodes.size(); ++i)
+    {
+        const std::vector<std::pair<std::optional<char>, int>> &nexts = other.nodes[i].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
         {
-            adjacencyMatrix[rows][listOfIndices[nextStates[k].second->getNodeName()]].push_back(nextStates[k].first);
+            nodes[offset + i].append(nexts[k].first, offset + nexts[k].second);
         }
     }
+    return offset;
 }
 
-NondetermAutomaton::NondetermAutomaton() : first{nullptr} {}
+NondetermAutomaton::NondetermAutomaton() : first{NO_NODE} {}
 
-NondetermAutomaton::~NondetermAutomaton()
-{
-    deleteNodes();
-}
+NondetermAutomaton::~NondetermAutomaton() = default;
 
 NondetermAutomaton::NondetermAutomaton(const NondetermAutomaton &other)
 {
@@ -407,7 +400,23 @@ NondetermAutomaton &NondetermAutomaton::operator=(const NondetermAutomaton &othe
     return *this;
 }
 
-NondetermAutomaton::NondetermAutomaton(const std::string &word)
+static_assert(std::is_nothrow_move_constructible_v<NondetermAutomaton> && std::is_nothrow_move_assignable_v<NondetermAutomaton>);
+
+NondetermAutomaton::NondetermAutomaton(NondetermAutomaton &&other) noexcept
+{
+    move(other);
+}
+
+NondetermAutomaton &NondetermAutomaton::operator=(NondetermAutomaton &&other) noexcept
+{
+    if (this != &other)
+    {
+        move(other);
+    }
+    return *this;
+}
+
+NondetermAutomaton::NondetermAutomaton(const std::string &word) : first{NO_NODE}
 {
 
     if (word.compare("@") == 0)
@@ -416,37 +425,22 @@ NondetermAutomaton::NondetermAutomaton(const std::string &word)
         return;
     }
     std::string nodeName = word;
-    Node *node = new Node(nodeName + std::to_string(0));
-    Node *prevNode;
-    first = node;
-    nodes[nodeName + std::to_string(0)] = first;
+    first = addNode(nodeName + std::to_string(0));
+    int node = first;
 
     for (int i = 0; i < word.size(); ++i)
     {
-        prevNode = node;
-        node = new Node(nodeName + std::to_string(i + 1));
-        try
-        {
-            prevNode->add(std::optional(word[i]), node);
-        }
-        catch (std::overflow_error error)
-        {
-            std::cout << error.what();
-        }
-
-        nodes[nodeName + std::to_string(i + 1)] = node;
+        int prevNode = node;
+        node = addNode(nodeName + std::to_string(i + 1));
+        nodes[prevNode].append(std::optional(word[i]), node);
     }
-    finalNodes.push_back(node);
+    finals[node] = true;
 }
 
 void NondetermAutomaton::buildEpsilonAuto()
 {
-    srand(time(NULL));
-    std::string name = "epsilonNode" + std::string(std::to_string(rand() % 100));
-    Node *node = new Node(name);
-    first = node;
-    nodes[name] = first;
-    finalNodes.push_back(node);
+    first = addNode(StateName("epsilonNode"));
+    finals[first] = true;
 }
 
 void NondetermAutomaton::addFirstNode(const std::string &nodeName)
@@ -456,8 +450,7 @@ void NondetermAutomaton::addFirstNode(const std::string &nodeName)
         throw std::invalid_argument("There is already a first element!");
     }
 
-    this->first = new Node(nodeName);
-    nodes[first->getNodeName()] = first;
+    first = addNode(nodeName);
 }
 
 void NondetermAutomaton::addTransition(const std::string &nodeStartName, const char &transitionChar, const std::string &nodeEndName)
@@ -467,91 +460,57 @@ void NondetermAutomaton::addTransition(const std::string &nodeStartName, const c
         throw std::bad_alloc();
     }
 
-    if (nodes.count(nodeStartName) == 0)
+    int startNode = findNode(nodeStartName);
+    if (startNode == NO_NODE)
     {
         throw std::invalid_argument("No starting node");
     }
-    if (nodes.count(nodeEndName) == 0)
+    int endNode = findNode(nodeEndName);
+    if (endNode == NO_NODE)
     {
-        nodes[nodeEndName] = new Node(nodeEndName);
+        endNode = addNode(nodeEndName);
     }
-    try
+    std::optional<char> symbol = transitionChar == '@' ? std::nullopt : std::optional(transitionChar);
+    if (!nodes[startNode].add(symbol, endNode))
     {
-        if (transitionChar == '@')
-        {
-            nodes[nodeStartName]->add(std::nullopt, nodes[nodeEndName]);
-        }
-        else
-        {
-            nodes[nodeStartName]->add(std::optional(transitionChar), nodes[nodeEndName]);
-        }
+        std::cout << "There is already the same transition.\n";
     }
-    catch (std::overflow_error warning)
+    else if (!symbol)
     {
-        std::cout << warning.what();
+        epsilonClosures.clear();
     }
 }
 
 void NondetermAutomaton::addFinals(const std::string &nodeName)
 {
-
-    if (nodes.count(nodeName) == 0)
+    int node = findNode(nodeName);
+    if (node == NO_NODE)
     {
         throw std::invalid_argument("No such final state");
     }
-    finalNodes.push_back(nodes[nodeName]);
+    finals[node] = true;
 }
 
 bool NondetermAutomaton::isEmpty() const
 {
-    return !first;
+    return first == NO_NODE;
 }
 
 bool NondetermAutomaton::isWordFromAuto(const std::string &transitionWord)
 {
-    int i = 0;
     NondetermAutomaton::AutoIterator it = this->begin();
     NondetermAutomaton::AutoIterator out = this->out();
-    NondetermAutomaton::AutoIterator prev;
-    while (i < transitionWord.size() && it != out)
-    {
-        if (it.hasEpsilonTransition() && it != prev)
-        {
-            prev = it;
-            it.epsilonTransition(*this);
-        }
-        else
-        {
-            it.transition(transitionWord[i++], *this);
-            prev = out;
-        }
-    }
-    NondetermAutomaton::AutoIterator finals = this->end();
-
-    if (i == transitionWord.size() && (it == finals))
-    {
-        return true;
-    }
-
-    if (!(it != out))
-    {
-        return false;
-    }
-    prev = it;
-    i = 0;
-    while (i < nodes.size() && it != out && !(it == finals))
+    it.epsilonClosure(*this);
+    for (int i = 0; i < transitionWord.size(); ++i)
     {
-        it.epsilonTransition(*this);
-
-        if (!(prev != it))
+        it.transition(transitionWord[i], *this);
+        if (!(it != out))
         {
-            it = out;
+            return false;
         }
-        prev = it;
-        ++i;
+        it.epsilonClosure(*this);
     }
-
-    return (it == finals);
+    return it.isFinal();
 }
 
 typename NondetermAutomaton::AutoIterator NondetermAutomaton::begin() const
@@ -560,17 +519,25 @@ typename NondetermAutomaton::AutoIterator NondetermAutomaton::begin() const
     {
         throw std::out_of_range("Empty automaton");
     }
-    return AutoIterator(first);
+    return AutoIterator(this, first);
 }
 
 typename NondetermAutomaton::AutoIterator NondetermAutomaton::end() const
 {
-    return AutoIterator(finalNodes);
+    std::vector<int> finalNodes;
+    for (int i = 0; i < nodes.size(); ++i)
+    {
+        if (finals[i])
+        {
+            finalNodes.push_back(i);
+        }
+    }
+    return AutoIterator(this, finalNodes);
 }
 
 typename NondetermAutomaton::AutoIterator NondetermAutomaton::out() const
 {
-    return AutoIterator();
+    return AutoIterator(this);
 }
 
 NondetermAutomaton NondetermAutomaton::complementation() const
@@ -582,355 +549,348 @@ NondetermAutomaton NondetermAutomaton::complementation() const
 
 void NondetermAutomaton::swapFinalStates()
 {
-    std::vector<Node *> newFinalNodes;
-
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
-    {
-        if (!isFinalState(i->second))
-        {
-            newFinalNodes.push_back(i->second);
-        }
-    }
-    finalNodes.clear();
-    finalNodes = newFinalNodes;
-}
-
-bool NondetermAutomaton::isFinalState(const NondetermAutomaton::Node *myNode)
-{
-    for (int i = 0; i < finalNodes.size(); ++i)
-    {
-        if (myNode == finalNodes[i])
-        {
-            return true;
-        }
-    }
-    return false;
+    finals.flip();
 }
 
-void NondetermAutomaton::visualize(std::ostream &out) const
+NondetermAutomaton NondetermAutomaton::reversal() const
 {
-    out << "Automat\n";
-    out << "First: " << first->getNodeName() << "\n";
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
+    if (isEmpty())
     {
-        visualizeHelper(out, i);
+        return NondetermAutomaton();
     }
-    out << "Finals: ";
-    for (int i = 0; i < finalNodes.size(); ++i)
+    NondetermAutomaton newAutomaton;
+    for (int i = 0; i < nodes.size(); ++i)
     {
-        out << finalNodes[i]->getNodeName() << " ";
+        newAutomaton.addNode(names[i]);
     }
-    out << std::endl;
-}
-
-void NondetermAutomaton::visualizeHelper(std::ostream &out, std::map<std::string, NondetermAutomaton::Node *>::const_iterator i) const
-{
-    out << i->second->getNodeName() << " ";
-    std::vector<std::pair<std::optional<char>, const NondetermAutomaton::Node *>> next = i->second->getNext();
-    for (int k = 0; k < next.size(); ++k)
+    for (int i = 0; i < nodes.size(); ++i)
     {
-        out << "(";
-        if (!next[k].first)
+        const std::vector<std::pair<std::optional<char>, int>> &nexts = nodes[i].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
         {
-            out << "epsilon";
+            newAutomaton.nodes[nexts[k].second].append(nexts[k].first, i);
         }
-        else
+    }
+    // the new first node leads to all final nodes, so there is a single first node
+    newAutomaton.first = newAutomaton.addNode(StateName::withSuffix(StateName("reversalFirst"), "#" + std::to_string(nodes.size())));
+    for (int i = 0; i < nodes.size(); ++i)
+    {
+        if (finals[i])
         {
-            out << *next[k].first;
+            newAutomaton.nodes[newAutomaton.first].append(std::nullopt, i);
         }
-        out << ", " << next[k].second->getNodeName() << ") ";
     }
-    out << " \n";
+    newAutomaton.finals[first] = true;
+    return newAutomaton;
 }
 
-bool NondetermAutomaton::equalChars(std::optional<char> first, std::optional<char> second)
+NondetermAutomaton NondetermAutomaton::unanchored() const
 {
-    return (!first && !second) || ((first && second) && (*first == *second));
-}
-
-NondetermAutomaton NondetermAutomaton::unions(const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto)
-{
-    NondetermAutomaton myAuto(firstAuto);
-    NondetermAutomaton secondAutoCopy(secondAuto);
-    NondetermAutomaton::makeUnique(firstAuto, secondAutoCopy);
-    myAuto.copyTransitions(secondAutoCopy);
-
-    myAuto.copyFinals(secondAutoCopy);
-
-    std::string firstStateName = "unique";
-    while (!myAuto.isUnique(firstStateName))
+    if (isEmpty())
     {
-        firstStateName.push_back('1');
+        return NondetermAutomaton();
     }
-    myAuto.first = new Node(firstStateName);
-    myAuto.nodes[myAuto.first->getNodeName()] = myAuto.first;
-    myAuto.addTransition(firstStateName, '@', firstAuto.first->getNodeName());
-    myAuto.addTransition(firstStateName, '@', secondAutoCopy.first->getNodeName());
-
-    return myAuto;
-}
-
-bool NondetermAutomaton::isUnique(const std::string &uniqueName) const
-{
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
+    NondetermAutomaton newAutomaton(*this);
+    newAutomaton.epsilonClosures.clear();
+    int node = newAutomaton.addNode(StateName::withSuffix(StateName("unanchoredFirst"), "#" + std::to_string(nodes.size())));
+    for (int symbol = 0; symbol < 256; ++symbol)
     {
-        if (uniqueName.compare(i->second->getNodeName()) == 0)
-        {
-            return false;
-        }
+        newAutomaton.nodes[node].append((char)symbol, node);
     }
-    return true;
+    newAutomaton.nodes[node].append(std::nullopt, first);
+    newAutomaton.first = node;
+    return newAutomaton;
 }
 
-NondetermAutomaton NondetermAutomaton::concatenation(const NondetermAutomaton &firstAuto, NondetermAutomaton &secondAuto)
+void NondetermAutomaton::listTransitions(std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions) const
 {
-    NondetermAutomaton myAuto;
-    myAuto.copyTransitions(firstAuto);
-    myAuto.first = myAuto.nodes[firstAuto.first->getNodeName()];
-
-    NondetermAutomaton::makeUnique(firstAuto, secondAuto );
-    myAuto.copyTransitions(secondAuto);
-
-    for (int i = 0; i < firstAuto.finalNodes.size(); ++i)
+    transitions.resize(nodes.size());
+    for (int i = 0; i < nodes.size(); ++i)
     {
-        myAuto.addTransition(firstAuto.finalNodes[i]->getNodeName(), '@', secondAuto .first->getNodeName());
+        transitions[i] = nodes[i].getNext();
     }
-    myAuto.copyFinals(secondAuto );
-
-    return myAuto;
 }
 
-void NondetermAutomaton::makeUnique(const NondetermAutomaton &firstAuto, NondetermAutomaton &secondAuto)
+ByteClasses NondetermAutomaton::buildByteClasses(const std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions)
 {
-    if (areUnique(firstAuto, secondAuto))
-    {
-        return;
-    }
-    srand(time(NULL));
-    std::map<std::string, Node *> newNodes;
-    for (auto s = secondAuto.nodes.begin(); s != secondAuto.nodes.end(); s++)
+    ByteClasses byteClasses;
+    for (int i = 0; i < transitions.size(); ++i)
     {
-        const std::string addToName = std::to_string(rand() % 100) + s->second->getNodeName();
-        s->second->pushBackToName(addToName);
-        newNodes[s->second->getNodeName()] = s->second;
+        for (int k = 0; k < transitions[i].size(); ++k)
+        {
+            if (transitions[i][k].first)
+            {
+                byteClasses.add(i, *transitions[i][k].first, transitions[i][k].second);
+            }
+        }
     }
-    secondAuto.nodes = newNodes;
+    byteClasses.build();
+    return byteClasses;
 }
 
-bool NondetermAutomaton::areUnique(const NondetermAutomaton &firstAuto, NondetermAutomaton &secondAuto)
+std::vector<StateSet> NondetermAutomaton::buildEpsilonClosures(const std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions)
 {
-    for (auto f = firstAuto.nodes.begin(); f != firstAuto.nodes.end(); f++)
+    std::vector<StateSet> closures;
+    for (int i = 0; i < transitions.size(); ++i)
     {
-        for (auto s = secondAuto.nodes.begin(); s != secondAuto.nodes.end(); s++)
+        StateSet closure(transitions.size());
+        closure.add(i);
+        std::vector<int> stack(1, i);
+        while (!stack.empty())
         {
-            if (f->first.compare(s->first) == 0)
+            int state = stack.back();
+            stack.pop_back();
+            for (int k = 0; k < transitions[state].size(); ++k)
             {
-                return false;
+                if (!transitions[state][k].first && closure.add(transitions[state][k].second))
+                {
+                    stack.push_back(transitions[state][k].second);
+                }
             }
         }
+        closures.push_back(closure);
     }
-    return true;
+    return closures;
 }
 
-NondetermAutomaton NondetermAutomaton::intersection(const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto)
+DetermAutomaton NondetermAutomaton::determinize() const
 {
-    NondetermAutomaton firstAutoCopy(firstAuto);
-    NondetermAutomaton secondAutoCopy(secondAuto);
-    NondetermAutomaton myAuto(intersectionHelper(firstAutoCopy, secondAutoCopy));
+    if (isEmpty())
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    std::vector<std::vector<std::pair<std::optional<char>, int>>> transitions;
+    listTransitions(transitions);
+    std::vector<StateSet> closures = buildEpsilonClosures(transitions);
+    ByteClasses byteClasses = buildByteClasses(transitions);
+    int size = nodes.size();
 
-    for (int i = 0; i < firstAutoCopy.finalNodes.size(); ++i)
+    StateSet finalStates(size);
+    for (int i = 0; i < size; ++i)
     {
-        for (int k = 0; k < secondAutoCopy.finalNodes.size(); ++k)
+        if (finals[i])
         {
-            std::string name = NondetermAutomaton::constructPair(firstAutoCopy.finalNodes[i], secondAutoCopy.finalNodes[k]);
-            myAuto.finalNodes.push_back(myAuto.nodes[name]);
+            finalStates.add(i);
         }
     }
-    return myAuto;
-}
 
-NondetermAutomaton NondetermAutomaton::intersectionHelper(NondetermAutomaton &firstAuto, NondetermAutomaton &secondAuto)
-{
+    std::vector<StateSet> subsets;
+    std::unordered_map<StateSet, int, StateSetHash> subsetIndices;
+    StateSet firstSubset = closures[first];
+    subsets.push_back(firstSubset);
+    subsetIndices[firstSubset] = 0;
 
-    NondetermAutomaton myAuto;
-    std::vector<std::string> listOfNodes;
-    NondetermAutomaton::makeUnique(firstAuto, secondAuto);
-    for (auto firstI = firstAuto.nodes.begin(); firstI != firstAuto.nodes.end(); firstI++)
+    AutoBuilder builder(1);
+    builder.setFirst(0);
+    for (int i = 0; i < subsets.size(); ++i)
     {
-        for (auto secondI = secondAuto.nodes.begin(); secondI != secondAuto.nodes.end(); secondI++)
+        std::vector<StateSet> nextSubsets(byteClasses.getClassesCount());
+        std::vector<int> symbols;
+        std::vector<int> members = subsets[i].getMembers();
+        for (int k = 0; k < members.size(); ++k)
         {
-            std::string name = NondetermAutomaton::constructPair(firstI->second, secondI->second);
-            Node *node = new Node(name);
-            myAuto.nodes[name] = node;
-            listOfNodes.push_back(name);
+            for (int t = 0; t < transitions[members[k]].size(); ++t)
+            {
+                if (!transitions[members[k]][t].first)
+                {
+                    continue;
+                }
+                int symbol = byteClasses.getClass(*transitions[members[k]][t].first);
+                if (nextSubsets[symbol].isEmpty())
+                {
+                    nextSubsets[symbol] = StateSet(size);
+                    symbols.push_back(symbol);
+                }
+                nextSubsets[symbol].unite(closures[transitions[members[k]][t].second]);
+            }
         }
-    }
-    myAuto.first = myAuto.nodes[NondetermAutomaton::constructPair(firstAuto.first, secondAuto.first)];
 
-    int matrixSize = secondAuto.nodes.size() * firstAuto.nodes.size();
-    std::vector< std::optional<char>> **adjencyMatrix = new std::vector<std::optional<char> > *[matrixSize];
-
-    for (int i = 0; i < matrixSize; ++i)
-    {
-        adjencyMatrix[i] = new std::vector< std::optional<char>>[matrixSize];
+        for (int k = 0; k < symbols.size(); ++k)
+        {
+            StateSet &next = nextSubsets[symbols[k]];
+            if (subsetIndices.count(next) == 0)
+            {
+                subsetIndices[next] = builder.addState();
+                subsets.push_back(next);
+            }
+            int nextState = subsetIndices[next];
+            const std::string &chars = byteClasses.getChars(symbols[k]);
+            for (int c = 0; c < chars.size(); ++c)
+            {
+                builder.addTransition(i, chars[c], nextState);
+            }
+        }
     }
 
-    myAuto.buildAdjencyMatrixIntersection(adjencyMatrix, firstAuto, secondAuto);
-
-    for (int row = 0; row < matrixSize; ++row)
+    for (int i = 0; i < subsets.size(); ++i)
     {
-        for (int col = 0; col < matrixSize; ++col)
+        if (subsets[i].intersects(finalStates))
         {
-            addAllTransitionChars(myAuto.nodes[listOfNodes[row]], adjencyMatrix[row][col], myAuto.nodes[listOfNodes[col]]);
+            builder.addFinal(i);
         }
     }
-    for (int i = 0; i < matrixSize; ++i)
-    {
-        delete adjencyMatrix[i];
-    }
-    delete adjencyMatrix;
-    return myAuto;
+    return builder.toDetermAutomaton();
 }
 
-std::string NondetermAutomaton::constructPair(const NondetermAutomaton::Node *firstNode, const NondetermAutomaton::Node *secondNode)
+bool NondetermAutomaton::isFinalState(int myNode) const
 {
-    return "(" + firstNode->getNodeName() + "," + secondNode->getNodeName() + ")";
+    return finals[myNode];
 }
 
-void NondetermAutomaton::buildAdjencyMatrixIntersection(std::vector<std::optional<char>> **adjencyMatrix, const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto)
+void NondetermAutomaton::visualize(std::ostream &out) const
 {
-    int sizeFirstAutoNodes = firstAuto.nodes.size();
-    int sizeSecondAutoNodes = secondAuto.nodes.size();
-    std::vector<std::optional<char>> **matrixFirstAuto, **matrixSecondAuto;
-    matrixFirstAuto = new std::vector<std::optional<char>> *[sizeFirstAutoNodes];
-    matrixSecondAuto = new std::vector<std::optional<char>> *[sizeSecondAutoNodes];
-
-    std::vector<std::string> listOfNodes1;
-    std::unordered_map<std::string, int> listOfIndices1;
-    std::vector<std::string> listOfNodes2;
-    std::unordered_map<std::string, int> listOfIndices2;
-
-    int counter = 0;
-    for (auto i = firstAuto.nodes.begin(); i != firstAuto.nodes.end(); i++)
+    out << "Automat\n";
+    out << "First: " << names[first].toString() << "\n";
+    for (int i = 0; i < nodes.size(); ++i)
     {
-        matrixFirstAuto[counter] = new std::vector<std::optional<char>>[sizeFirstAutoNodes];
-        listOfNodes1.push_back(i->second->getNodeName());
-        listOfIndices1[i->second->getNodeName()] = counter++;
+        visualizeHelper(out, i);
     }
-    counter = 0;
-    for (auto i = secondAuto.nodes.begin(); i != secondAuto.nodes.end(); i++)
+    out << "Finals: ";
+    for (int i = 0; i < nodes.size(); ++i)
     {
-        matrixSecondAuto[counter] = new std::vector<std::optional<char>>[sizeSecondAutoNodes];
-        listOfNodes2.push_back(i->second->getNodeName());
-        listOfIndices2[i->second->getNodeName()] = counter++;
+        if (finals[i])
+        {
+            out << names[i].toString() << " ";
+        }
     }
+    out << std::endl;
+}
 
-    firstAuto.buildAdjencyMatrix(matrixFirstAuto, listOfNodes1, listOfIndices1, false);
-    secondAuto.buildAdjencyMatrix(matrixSecondAuto, listOfNodes2, listOfIndices2, false);
-
-    for (int rowFirst = 0; rowFirst < sizeFirstAutoNodes; ++rowFirst)
+void NondetermAutomaton::visualizeHelper(std::ostream &out, int node) const
+{
+    out << names[node].toString() << " ";
+    const std::vector<std::pair<std::optional<char>, int>> &next = nodes[node].getNext();
+    for (int k = 0; k < next.size(); ++k)
     {
-        for (int rowSecond = 0; rowSecond < sizeSecondAutoNodes; ++rowSecond)
+        out << "(";
+        if (!next[k].first)
         {
-            buildAdjencyMatrixIntersectionHelper(adjencyMatrix,
-                                                 firstAuto, secondAuto,
-                                                 sizeFirstAutoNodes, sizeSecondAutoNodes, listOfNodes1, listOfNodes2,
-                                                 rowFirst, rowSecond);
+            out << "epsilon";
         }
+        else
+        {
+            out << *next[k].first;
+        }
+        out << ", " << names[next[k].second].toString() << ") ";
     }
+    out << " \n";
+}
 
-    for (int i = 0; i < sizeFirstAutoNodes; ++i)
-    {
-        delete matrixFirstAuto[i];
-    }
-    for (int i = 0; i < sizeSecondAutoNodes; ++i)
+bool NondetermAutomaton::equalChars(std::optional<char> first, std::optional<char> second)
+{
+    return (!first && !second) || ((first && second) && (*first == *second));
+}
+
+NondetermAutomaton NondetermAutomaton::unions(const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto)
+{
+    NondetermAutomaton myAuto(firstAuto);
+    int offset = myAuto.appendNodes(secondAuto);
+
+    std::string firstStateName = "unique";
+    while (!myAuto.isUnique(firstStateName))
     {
-        delete matrixSecondAuto[i];
+        firstStateName.push_back('1');
     }
-    delete matrixFirstAuto;
-    delete matrixSecondAuto;
+    myAuto.first = myAuto.addNode(firstStateName);
+    myAuto.nodes[myAuto.first].add(std::nullopt, firstAuto.first);
+    myAuto.nodes[myAuto.first].add(std::nullopt, offset + secondAuto.first);
+
+    return myAuto;
 }
 
-void NondetermAutomaton::buildAdjencyMatrixIntersectionHelper(std::vector<std::optional<char>> **adjencyMatrix,
-                                                              const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto,
-                                                              const int &sizeFirstAutoNodes, const int &sizeSecondAutoNodes, const std::vector<std::string> &listOfNodes1, const std::vector<std::string> &listOfNodes2,
-                                                              const int &rowFirst, const int &rowSecond)
+bool NondetermAutomaton::isUnique(const std::string &uniqueName) const
 {
-    for (int colFirst = 0; colFirst < sizeFirstAutoNodes; ++colFirst)
+    return findNode(uniqueName) == NO_NODE;
+}
+
+NondetermAutomaton NondetermAutomaton::concatenation(const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto)
+{
+    NondetermAutomaton myAuto(firstAuto);
+    myAuto.finals.assign(myAuto.finals.size(), false);
+
+    int offset = myAuto.appendNodes(secondAuto);
+
+    for (int i = 0; i < firstAuto.nodes.size(); ++i)
     {
-        for (int colSecond = 0; colSecond < sizeSecondAutoNodes; ++colSecond)
+        if (!firstAuto.finals[i])
         {
-            std::vector<std::optional<char>> transitionFirst = firstAuto.reach(listOfNodes1[rowFirst], listOfNodes1[colFirst]);
-            std::vector<std::optional<char>> transitionSecond = secondAuto.reach(listOfNodes2[rowSecond], listOfNodes2[colSecond]);
-            NondetermAutomaton::pushBackEqualChars(adjencyMatrix[rowFirst * sizeSecondAutoNodes + rowSecond]
-                                                                [colFirst * sizeSecondAutoNodes + colSecond],
-                                                   transitionFirst, transitionSecond);
+            continue;
         }
+        myAuto.nodes[i].add(std::nullopt, offset + secondAuto.first);
     }
+
+    return myAuto;
 }
 
-void NondetermAutomaton::addAllTransitionChars(Node *startNode, std::vector<std::optional<char>> &transitionChars, const Node *destinationNode)
+NondetermAutomaton NondetermAutomaton::intersection(const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto)
 {
-    for (int i = 0; i < transitionChars.size(); ++i)
+    NondetermAutomaton myAuto;
+    int secondSize = secondAuto.nodes.size();
+    for (int i = 0; i < firstAuto.nodes.size(); ++i)
     {
-        try
+        for (int k = 0; k < secondSize; ++k)
         {
-            startNode->add(transitionChars[i], destinationNode);
-        }
-        catch (std::overflow_error error)
-        {
-            std::cout << error.what();
+            myAuto.addNode(StateName::pair(firstAuto.names[i], secondAuto.names[k]));
         }
     }
-}
+    myAuto.first = firstAuto.first * secondSize + secondAuto.first;
 
-void NondetermAutomaton::pushBackEqualChars(std::vector<std::optional<char>> &destination, const std::vector<std::optional<char>> &str1, const std::vector<std::optional<char>> &str2)
-{
-    for (int i = 0; i < str1.size(); ++i)
+    // an epsilon transition moves only its own auto, a char moves both autos
+    for (int i = 0; i < firstAuto.nodes.size(); ++i)
     {
-        for (int k = 0; k < str2.size(); ++k)
+        const std::vector<std::pair<std::optional<char>, int>> &firstNexts = firstAuto.nodes[i].getNext();
+        for (int k = 0; k < secondSize; ++k)
         {
-            if (!str1[i] || !str2[k] || *str1[i] == *str2[k])
+            const std::vector<std::pair<std::optional<char>, int>> &secondNexts = secondAuto.nodes[k].getNext();
+            Node &node = myAuto.nodes[i * secondSize + k];
+            for (int f = 0; f < firstNexts.size(); ++f)
             {
-                destination.push_back(str1[i]);
+                if (!firstNexts[f].first)
+                {
+                    node.add(std::nullopt, firstNexts[f].second * secondSize + k);
+                    continue;
+                }
+                for (int s = 0; s < secondNexts.size(); ++s)
+                {
+                    if (secondNexts[s].first && *firstNexts[f].first == *secondNexts[s].first)
+                    {
+                        node.add(firstNexts[f].first, firstNexts[f].second * secondSize + secondNexts[s].second);
+                    }
+                }
+            }
+            for (int s = 0; s < secondNexts.size(); ++s)
+            {
+                if (!secondNexts[s].first)
+                {
+                    node.add(std::nullopt, i * secondSize + secondNexts[s].second);
+                }
             }
         }
     }
-}
 
-std::vector<std::optional<char>> NondetermAutomaton::reach(const std::string &index1, const std::string &index2) const
-{
-
-    std::vector<std::optional<char>> transitionChars;
-    std::vector<std::pair<std::optional<char>, const NondetermAutomaton::Node *>> nexts = nodes.at(index1)->getNext();
-    for (int i = 0; i < nexts.size(); ++i)
+    for (int i = 0; i < firstAuto.nodes.size(); ++i)
     {
-        if (nodes.at(index2)->getNodeName().compare(nexts[i].second->getNodeName()) == 0)
+        for (int k = 0; k < secondSize; ++k)
         {
-            transitionChars.push_back(nexts[i].first);
+            myAuto.finals[i * secondSize + k] = firstAuto.finals[i] && secondAuto.finals[k];
         }
     }
-    return transitionChars;
+    return myAuto;
 }
 
 NondetermAutomaton NondetermAutomaton::kleeneStar(const NondetermAutomaton &firstAuto)
 {
     NondetermAutomaton myAuto(firstAuto);
-    for (int i = 0; i < myAuto.finalNodes.size(); ++i)
+    myAuto.epsilonClosures.clear();
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
     {
-        try
+        if (!myAuto.finals[i])
         {
-            myAuto.finalNodes[i]->add(std::nullopt, myAuto.first);
+            continue;
         }
-        catch (std::overflow_error error)
-        {
-            std::cout << error.what();
-        }
-    }
-    if (!myAuto.isFinalState(myAuto.first))
-    {
-        myAuto.finalNodes.push_back(myAuto.first);
+        myAuto.nodes[i].add(std::nullopt, myAuto.first);
     }
+    myAuto.finals[myAuto.first] = true;
 
     return myAuto;
 }
@@ -7,112 +7,103 @@
 #include <utility>
 #include <fstream>
 #include <optional>
+#include <string>
+#include "stateSet.h"
+#include "../Deterministic/determAuto.h"
 
 ///class NondetermAutomaton allows the user to work with a nondeterministic automaton
 class NondetermAutomaton
 {
+    ///marks a missing node
+    static constexpr int NO_NODE = -1;
+
     struct Node
     {
     private:
-        std::string nodeName;
-        std::vector<std::pair<std::optional<char>, const Node *>> next;
-        void copy(const Node &);
+        std::vector<std::pair<std::optional<char>, int>> next;
 
     public:
-        Node(const std::string &name) : nodeName{name} {}
-
-        ~Node() = default;
-
-        Node &operator=(const Node &);
+        ///adds a transition from this node to the node with the index, returns false if the same transition is already there
+        bool add(std::optional<char>, int);
 
-        Node(const Node &);
+        ///adds a transition without checking whether the same transition is already there
+        void append(std::optional<char>, int);
 
-        ///adds a transition from this node to another node
-        void add(std::optional<char>, const Node *);
-
-        std::string getNodeName() const;
-
-        ///returns the list of nodes to which there is a transition from this node with the char
-        std::vector<NondetermAutomaton::Node const *> hasSymbolTransition(std::optional<char>) const;
+        ///returns the list of indices of the nodes to which there is a transition from this node with the char
+        std::vector<int> hasSymbolTransition(std::optional<char>) const;
 
         ///returns the list of transitions from this node
-        std::vector<std::pair<std::optional<char>, const Node *>> getNext() const;
-
-        ///checks whether the node is from the list of nodes
-        bool isNodeFromTransitionList(std::vector<Node const *>) const;
-
-        ///changes the name of the node by appending a string to the end
-        void pushBackToName(const std::string &);
+        const std::vector<std::pair<std::optional<char>, int>> &getNext() const;
     };
 
-    Node *first;
-    std::vector<Node *> finalNodes;
-    std::map<std::string, Node *> nodes;
-
-    void deleteNodes();
+    ///the nodes are numbered from 0 to nodes.size() - 1 and their transitions hold the indices of the next nodes
+    int first;
+    std::vector<Node> nodes;
+    ///marks the final nodes by their indices
+    std::vector<bool> finals;
+    ///the names are only used to build the auto node by node and to print it, the plain names are indexed when they are added
+    ///and the names of products and renamed nodes are printed and indexed only when a name is not found
+    std::vector<StateName> names;
+    mutable std::unordered_map<std::string, int> nameIndices;
+    ///the nodes before this index have their names in nameIndices
+    mutable int indexedNodesCount = 0;
+    ///the epsilon closure of every node, an empty closure is not computed yet
+    mutable std::vector<std::vector<int>> epsilonClosures;
 
     void copy(const NondetermAutomaton &);
 
-    void copyTransitions(const NondetermAutomaton &);
+    ///takes the nodes of the other auto and leaves it empty
+    void move(NondetermAutomaton &) noexcept;
 
-    void copyFinals(const NondetermAutomaton &other);
+    ///adds a node without transitions and returns its index
+    int addNode(const StateName &);
 
-    bool isFinalState(const Node *);
+    ///returns the index of the node with the name or NO_NODE
+    int findNode(const std::string &) const;
 
-    ///builds an adjency matrix of the nodes of the automaton
-    void buildAdjencyMatrix(std::vector<std::optional<char>> **adjacencyMatrix, std::vector<std::string> listOfNodes,
-                            const std::unordered_map<std::string, int>, bool b) const;
+    ///adds the nodes of the other auto with its final nodes after the nodes of this one and returns the index of its first node,
+    ///the nodes with names of nodes of this auto are renamed with a number
+    int appendNodes(const NondetermAutomaton &);
 
-    static void buildAdjencyMatrixIntersection(std::vector<std::optional<char>> **, const NondetermAutomaton &, const NondetermAutomaton &);
+    bool isFinalState(int) const;
 
     ///builds an automaton with language = {epsilon}
     void buildEpsilonAuto();
 
-    ///returns a string constructed with the names of both nodes
-    static std::string constructPair(const NondetermAutomaton::Node *, const NondetermAutomaton::Node *);
-
-    ///adds transitions from the first node to the second with the chars
-    static void addAllTransitionChars(Node *startNode, std::vector<std::optional<char>> &chars, const Node *destination);
+    void visualizeHelper(std::ostream &out, int) const;
 
-    ///builds a vector of chars with the chars which repeats in the const vectors
-    static void pushBackEqualChars(std::vector<std::optional<char>> &,
-                                   const std::vector<std::optional<char>> &, const std::vector<std::optional<char>> &);
+    ///lists the transitions of every node by the indices of the nodes
+    void listTransitions(std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions) const;
 
-    ///returns the transition chars from node with index1 to node with index2
-    std::vector<std::optional<char>> reach(const std::string &index1, const std::string &index2) const;
+    ///returns the nodes reachable from the node with epsilon transitions, it is computed once per node
+    const std::vector<int> &getEpsilonClosure(int) const;
 
-    static NondetermAutomaton intersectionHelper(NondetermAutomaton &, NondetermAutomaton &);
+    ///splits the chars to the classes which the numbered transitions tell apart
+    static ByteClasses buildByteClasses(const std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions);
 
-    void copyTransitionsHelper(const int &size, std::vector<std::optional<char>> **adjacencyMatrix,
-                               const int &rows, const std::vector<std::string> &listOfNodes);
-
-    void visualizeHelper(std::ostream &out, std::map<std::string, NondetermAutomaton::Node *>::const_iterator i) const;
-
-    static void buildAdjencyMatrixIntersectionHelper(std::vector<std::optional<char>> **adjencyMatrix,
-                                                     const NondetermAutomaton &firstAuto, const NondetermAutomaton &secondAuto,
-                                                     const int &sizeFirstAutoNodes, const int &sizeSecondAutoNodes,
-                                                     const std::vector<std::string> &listOfNodes1, const std::vector<std::string> &listOfNodes2,
-                                                     const int &rowFirst, const int &rowSecond);
+    ///returns for every state the set of states reachable from it with epsilon transitions
+    static std::vector<StateSet> buildEpsilonClosures(const std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions);
 
 public:
     ///class AutoIterator iterates the automaton
     class AutoIterator
     {
-        std::vector<const NondetermAutomaton::Node *> current;
+        const NondetermAutomaton *automaton;
+        std::vector<int> current;
 
         void copy(const AutoIterator &other);
 
         void transitionHelper(const char &transitionChar, const NondetermAutomaton &automaton,
-                              std::vector<const NondetermAutomaton::Node *> &newNodes, const int &i);
+                              std::vector<int> &newNodes, const int &i);
 
-        void epsilonTransitionHelper(const int &i, std::vector<const NondetermAutomaton::Node *> &newNodes);
+        void epsilonTransitionHelper(const int &i, std::vector<int> &newNodes);
 
     public:
-        AutoIterator() = default;
+        AutoIterator(const NondetermAutomaton *_automaton = nullptr) : automaton{_automaton} {}
 
-        AutoIterator(NondetermAutomaton::Node *node);
+        AutoIterator(const NondetermAutomaton *, int node);
 
-        AutoIterator(std::vector<NondetermAutomaton::Node *>);
+        AutoIterator(const NondetermAutomaton *, const std::vector<int> &nodes);
 
         AutoIterator &operator=(const AutoIterator &other);
 
@@ -125,6 +116,9 @@ public:
         ///returns the list of names of the current nodes
         std::vector<std::string> operator*();
 
+        ///checks whether one of the current nodes is final
+        bool isFinal() const;
+
         ///makes a transition with the char in the automaton
         AutoIterator &transition(const char transitionChar, const NondetermAutomaton &automaton);
 
@@ -133,6 +127,9 @@ public:
 
         ///checks whether there is an epsilon transition from the current nodes
         bool hasEpsilonTransition();
+
+        ///adds all nodes reachable with epsilon transitions using the precomputed closures of the automaton
+        AutoIterator &epsilonClosure(const NondetermAutomaton &automaton);
     };
 
     NondetermAutomaton();
@@ -143,6 +140,10 @@ public:
 
     NondetermAutomaton &operator=(const NondetermAutomaton &);
 
+    NondetermAutomaton(NondetermAutomaton &&) noexcept;
+
+    NondetermAutomaton &operator=(NondetermAutomaton &&) noexcept;
+
     NondetermAutomaton(const std::string &);
 
     void addFirstNode(const std::string &);
@@ -170,6 +171,15 @@ public:
     ///makes the final states nonfinal and makes the nonfinal states final
     void swapFinalStates();
 
+    ///returns an auto the language of which is the reversed words of the language of this auto
+    NondetermAutomaton reversal() const;
+
+    ///returns an auto the language of which is all words which end with a word from the language of this auto
+    NondetermAutomaton unanchored() const;
+
+    ///returns a deterministic auto with the same language built with the subset construction
+    DetermAutomaton determinize() const;
+
     ///prints information about the auto
     void visualize(std::ostream &) const;
 
@@ -183,7 +193,7 @@ public:
     static NondetermAutomaton unions(const NondetermAutomaton &, const NondetermAutomaton &);
 
     ///returns an auto the language of which is a concatenation of the languages of the two autos
-    static NondetermAutomaton concatenation(const NondetermAutomaton &, NondetermAutomaton &);
+    static NondetermAutomaton concatenation(const NondetermAutomaton &, const NondetermAutomaton &);
 
     ///returns an auto the language of which is an intersection of the languages of the two autos
     static NondetermAutomaton intersection(const NondetermAutomaton &, const NondetermAutomaton &);
@@ -191,11 +201,19 @@ public:
     ///returns an auto the language of which is transformation of the languages of the two autos with  Kleene's star
     static NondetermAutomaton kleeneStar(const NondetermAutomaton &);
 
-    ///makes the names of the nodes of the second auto unique to the names of the nodes of the first one
-    static void makeUnique(const NondetermAutomaton &, NondetermAutomaton &);
+    friend class LazyDetermAutomaton;
+
+    friend class BitsetNondetermAutomaton;
+
+    friend class AutoSerializer;
+
+    friend class AutoBuilder;
+
+    friend class PatternCache;
+
+    friend class Parser;
 
-    ///checks whether the names of the nodes of the two autos are unique to each other
-    static bool areUnique(const NondetermAutomaton &firstAuto, NondetermAutomaton &secondAuto);
+    friend class GlushkovParser;
 };
 
 std::ostream &operator<<(std::ostream &out, const NondetermAutomaton &);
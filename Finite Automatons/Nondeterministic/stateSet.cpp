@@ -0,0 +1,81 @@
+#include "stateSet.h"
+
+StateSet::StateSet(int size) : words((size + 63) / 64, 0) {}
+
+bool StateSet::add(int state)
+{
+    std::uint64_t bit = std::uint64_t(1) << (state % 64);
+    if (words[state / 64] & bit)
+    {
+        return false;
+    }
+    words[state / 64] |= bit;
+    return true;
+}
+
+bool StateSet::contains(int state) const
+{
+    return (words[state / 64] >> (state % 64)) & 1;
+}
+
+void StateSet::unite(const StateSet &other)
+{
+    for (int i = 0; i < words.size(); ++i)
+    {
+        words[i] |= other.words[i];
+    }
+}
+
+bool StateSet::intersects(const StateSet &other) const
+{
+    for (int i = 0; i < words.size(); ++i)
+    {
+        if (words[i] & other.words[i])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool StateSet::isEmpty() const
+{
+    for (int i = 0; i < words.size(); ++i)
+    {
+        if (words[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<int> StateSet::getMembers() const
+{
+    std::vector<int> members;
+    for (int i = 0; i < words.size(); ++i)
+    {
+        std::uint64_t word = words[i];
+        while (word)
+        {
+            members.push_back(i * 64 + __builtin_ctzll(word));
+            word &= word - 1;
+        }
+    }
+    return members;
+}
+
+std::size_t StateSet::hash() const
+{
+    std::size_t result = words.size();
+    for (int i = 0; i < words.size(); ++i)
+    {
+        result ^= words[i] + 0x9e3779b97f4a7c15ULL + (result << 6) + (result >> 2);
+    }
+    return result;
+}
+
+bool StateSet::operator==(const StateSet &other) const
+{
+    return words == other.words;
+}
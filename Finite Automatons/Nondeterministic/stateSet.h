@@ -0,0 +1,42 @@
+#ifndef STATE_SET_H
+#define STATE_SET_H
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+///class StateSet is a set of state indices stored as a bitset
+class StateSet
+{
+    std::vector<std::uint64_t> words;
+
+public:
+    StateSet(int size = 0);
+
+    ///adds the state to the set and returns whether it was missing
+    bool add(int);
+
+    bool contains(int) const;
+
+    ///adds all states of the other set
+    void unite(const StateSet &);
+
+    ///checks whether the sets have a common state
+    bool intersects(const StateSet &) const;
+
+    bool isEmpty() const;
+
+    ///returns the indices of the states in increasing order
+    std::vector<int> getMembers() const;
+
+    std::size_t hash() const;
+
+    bool operator==(const StateSet &) const;
+};
+
+///struct StateSetHash allows StateSet to be used as a key of unordered containers
+struct StateSetHash
+{
+    std::size_t operator()(const StateSet &set) const { return set.hash(); }
+};
+
+#endif
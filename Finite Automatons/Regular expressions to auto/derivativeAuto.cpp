@@ -0,0 +1,452 @@
+#include <algorithm>
+#include <stdexcept>
+#include "derivativeAuto.h"
+#include "expressionTokenizer.h"
+
+void DerivativeAutomaton::calculate(std::stack<int> &operands, const char &oper)
+{
+    int one = popTerm(operands);
+    switch (oper)
+    {
+    case '*':
+        operands.push(makeStar(one));
+        return;
+    case '~':
+        operands.push(makeComplement(one));
+        return;
+    }
+
+    int two = popTerm(operands);
+    switch (oper)
+    {
+    case '+':
+        operands.push(makeUnion({two, one}));
+        return;
+    case '&':
+        operands.push(makeIntersection({two, one}));
+        return;
+    default:
+        operands.push(makeConcatenation(two, one));
+        return;
+    }
+}
+
+int DerivativeAutomaton::parseExpression(const std::string &expression)
+{
+    // every operation is applied as soon as it is read, the complement is a unary operation like the star
+    std::vector<ExpressionTokenizer::Token> tokens = ExpressionTokenizer("*~").tokenize(expression);
+    std::stack<int> operands;
+    for (int i = 0; i < tokens.size(); i++)
+    {
+        if (tokens[i].operation == '\0')
+        {
+            operands.push(parseWord(tokens[i].word, tokens[i].lastCharOperation));
+        }
+        else
+        {
+            calculate(operands, tokens[i].operation);
+        }
+    }
+    return popTerm(operands);
+}
+
+int DerivativeAutomaton::parseWord(const std::string &word, const char &oper)
+{
+    if (word.compare("@") == 0)
+    {
+        return oper == '~' ? makeComplement(EPSILON_TERM) : EPSILON_TERM;
+    }
+
+    // the word is joined from its last char, so every char is added before the concatenation of the next ones
+    int myTerm = EPSILON_TERM;
+    for (int i = word.size() - 1; i >= 0; --i)
+    {
+        int symbolTerm = makeSymbol(word[i]);
+        if (i == word.size() - 1 && oper != '\0')
+        {
+            // as in Parser the repeated @ is epsilon
+            symbolTerm = word[i] == '@' ? EPSILON_TERM : symbolTerm;
+            symbolTerm = oper == '*' ? makeStar(symbolTerm) : makeComplement(symbolTerm);
+        }
+        myTerm = makeConcatenation(symbolTerm, myTerm);
+    }
+    return myTerm;
+}
+
+int DerivativeAutomaton::popTerm(std::stack<int> &operands)
+{
+    if (operands.empty())
+    {
+        throw std::invalid_argument("Invalid regular expression");
+    }
+    int myTerm = operands.top();
+    operands.pop();
+    return myTerm;
+}
+
+int DerivativeAutomaton::addTerm(Kind kind, const char &symbol, const std::vector<int> &operands)
+{
+    std::tuple<Kind, char, std::vector<int>> key(kind, symbol, operands);
+    auto found = termIndices.find(key);
+    if (found != termIndices.end())
+    {
+        return found->second;
+    }
+
+    bool isNullable = false;
+    switch (kind)
+    {
+    case Kind::EPSILON:
+    case Kind::STAR:
+        isNullable = true;
+        break;
+    case Kind::CONCATENATION:
+    case Kind::INTERSECTION:
+        isNullable = true;
+        for (int i = 0; i < operands.size(); ++i)
+        {
+            isNullable = isNullable && terms[operands[i]].isNullable;
+        }
+        break;
+    case Kind::UNION:
+        for (int i = 0; i < operands.size(); ++i)
+        {
+            isNullable = isNullable || terms[operands[i]].isNullable;
+        }
+        break;
+    case Kind::COMPLEMENT:
+        isNullable = !terms[operands[0]].isNullable;
+        break;
+    default:
+        break;
+    }
+
+    int index = terms.size();
+    terms.push_back(Term{kind, symbol, operands, isNullable});
+    termIndices[key] = index;
+    derivatives.emplace_back();
+    return index;
+}
+
+int DerivativeAutomaton::makeSymbol(const char &symbol)
+{
+    return addTerm(Kind::SYMBOL, symbol, {});
+}
+
+int DerivativeAutomaton::makeConcatenation(int first, int second)
+{
+    if (first == EMPTY_TERM || second == EMPTY_TERM)
+    {
+        return EMPTY_TERM;
+    }
+    if (first == EPSILON_TERM)
+    {
+        return second;
+    }
+    if (second == EPSILON_TERM)
+    {
+        return first;
+    }
+    // the concatenations are kept nested to the right, so equal languages get the same term more often,
+    // the operands of the first one are joined to the second term from its last operand without recursion
+    std::vector<int> lefts;
+    for (; terms[first].kind == Kind::CONCATENATION; first = terms[first].operands[1])
+    {
+        lefts.push_back(terms[first].operands[0]);
+    }
+    int myTerm = addTerm(Kind::CONCATENATION, '\0', {first, second});
+    for (int i = lefts.size() - 1; i >= 0; --i)
+    {
+        myTerm = addTerm(Kind::CONCATENATION, '\0', {lefts[i], myTerm});
+    }
+    return myTerm;
+}
+
+int DerivativeAutomaton::makeUnion(const std::vector<int> &operands)
+{
+    std::vector<int> myOperands;
+    for (int i = 0; i < operands.size(); ++i)
+    {
+        if (operands[i] == ALL_TERM)
+        {
+            return ALL_TERM;
+        }
+        if (terms[operands[i]].kind == Kind::UNION)
+        {
+            myOperands.insert(myOperands.end(), terms[operands[i]].operands.begin(), terms[operands[i]].operands.end());
+        }
+        else if (operands[i] != EMPTY_TERM)
+        {
+            myOperands.push_back(operands[i]);
+        }
+    }
+    std::sort(myOperands.begin(), myOperands.end());
+    myOperands.erase(std::unique(myOperands.begin(), myOperands.end()), myOperands.end());
+    if (myOperands.empty())
+    {
+        return EMPTY_TERM;
+    }
+    if (myOperands.size() == 1)
+    {
+        return myOperands[0];
+    }
+    return addTerm(Kind::UNION, '\0', myOperands);
+}
+
+int DerivativeAutomaton::makeIntersection(const std::vector<int> &operands)
+{
+    std::vector<int> myOperands;
+    for (int i = 0; i < operands.size(); ++i)
+    {
+        if (operands[i] == EMPTY_TERM)
+        {
+            return EMPTY_TERM;
+        }
+        if (terms[operands[i]].kind == Kind::INTERSECTION)
+        {
+            myOperands.insert(myOperands.end(), terms[operands[i]].operands.begin(), terms[operands[i]].operands.end());
+        }
+        else if (operands[i] != ALL_TERM)
+        {
+            myOperands.push_back(operands[i]);
+        }
+    }
+    std::sort(myOperands.begin(), myOperands.end());
+    myOperands.erase(std::unique(myOperands.begin(), myOperands.end()), myOperands.end());
+    if (myOperands.empty())
+    {
+        return ALL_TERM;
+    }
+    if (myOperands.size() == 1)
+    {
+        return myOperands[0];
+    }
+    // the empty intersections which can be seen from the operands, e.g. a&b, @&a and a&a~, are not added
+    bool isNullable = true;
+    int symbolsCount = 0;
+    for (int i = 0; i < myOperands.size(); ++i)
+    {
+        const Term &term = terms[myOperands[i]];
+        isNullable = isNullable && term.isNullable;
+        symbolsCount += term.kind == Kind::SYMBOL;
+        if (term.kind == Kind::COMPLEMENT && std::binary_search(myOperands.begin(), myOperands.end(), term.operands[0]))
+        {
+            return EMPTY_TERM;
+        }
+    }
+    if (symbolsCount > 1 || (myOperands[0] == EPSILON_TERM && !isNullable))
+    {
+        return EMPTY_TERM;
+    }
+    if (myOperands[0] == EPSILON_TERM)
+    {
+        return EPSILON_TERM;
+    }
+    return addTerm(Kind::INTERSECTION, '\0', myOperands);
+}
+
+int DerivativeAutomaton::makeComplement(int operand)
+{
+    if (terms[operand].kind == Kind::COMPLEMENT)
+    {
+        return terms[operand].operands[0];
+    }
+    return addTerm(Kind::COMPLEMENT, '\0', {operand});
+}
+
+int DerivativeAutomaton::makeStar(int operand)
+{
+    if (operand == EMPTY_TERM || operand == EPSILON_TERM)
+    {
+        return EPSILON_TERM;
+    }
+    if (terms[operand].kind == Kind::STAR)
+    {
+        return operand;
+    }
+    return addTerm(Kind::STAR, '\0', {operand});
+}
+
+int DerivativeAutomaton::derivative(int term, int byteClass)
+{
+    if (!derivatives[term].empty() && derivatives[term][byteClass] != UNKNOWN_STATE)
+    {
+        return derivatives[term][byteClass];
+    }
+
+    // the list of operands is copied because adding terms can move the terms
+    Term myTerm = terms[term];
+    int result = EMPTY_TERM;
+    switch (myTerm.kind)
+    {
+    case Kind::SYMBOL:
+        result = myTerm.symbol == classChars[byteClass] ? EPSILON_TERM : EMPTY_TERM;
+        break;
+    case Kind::CONCATENATION:
+    {
+        int firstDerivative = makeConcatenation(derivative(myTerm.operands[0], byteClass), myTerm.operands[1]);
+        result = terms[myTerm.operands[0]].isNullable ? makeUnion({firstDerivative, derivative(myTerm.operands[1], byteClass)})
+                                                      : firstDerivative;
+        break;
+    }
+    case Kind::UNION:
+    case Kind::INTERSECTION:
+    {
+        std::vector<int> operandDerivatives;
+        for (int i = 0; i < myTerm.operands.size(); ++i)
+        {
+            operandDerivatives.push_back(derivative(myTerm.operands[i], byteClass));
+        }
+        result = myTerm.kind == Kind::UNION ? makeUnion(operandDerivatives) : makeIntersection(operandDerivatives);
+        break;
+    }
+    case Kind::COMPLEMENT:
+        result = makeComplement(derivative(myTerm.operands[0], byteClass));
+        break;
+    case Kind::STAR:
+        result = makeConcatenation(derivative(myTerm.operands[0], byteClass), term);
+        break;
+    default:
+        break;
+    }
+
+    if (derivatives[term].empty())
+    {
+        derivatives[term].assign(classesCount, UNKNOWN_STATE);
+    }
+    derivatives[term][byteClass] = result;
+    return result;
+}
+
+int DerivativeAutomaton::copyTerm(const std::vector<Term> &otherTerms, int term)
+{
+    if (term < expressionTermsCount)
+    {
+        return term;
+    }
+    std::vector<int> operands;
+    for (int i = 0; i < otherTerms[term].operands.size(); ++i)
+    {
+        operands.push_back(copyTerm(otherTerms, otherTerms[term].operands[i]));
+    }
+    if (otherTerms[term].kind == Kind::UNION || otherTerms[term].kind == Kind::INTERSECTION)
+    {
+        std::sort(operands.begin(), operands.end());
+    }
+    return addTerm(otherTerms[term].kind, otherTerms[term].symbol, operands);
+}
+
+int DerivativeAutomaton::addState(int term)
+{
+    auto found = stateIndices.find(term);
+    if (found != stateIndices.end())
+    {
+        return found->second;
+    }
+    int index = states.size();
+    states.push_back(term);
+    stateIndices[term] = index;
+    table.resize(table.size() + classesCount, UNKNOWN_STATE);
+    finals.push_back(terms[term].isNullable);
+    return index;
+}
+
+void DerivativeAutomaton::clearCache()
+{
+    terms.resize(expressionTermsCount);
+    derivatives.assign(expressionTermsCount, std::vector<int>());
+    termIndices.clear();
+    for (int i = 0; i < terms.size(); ++i)
+    {
+        termIndices[std::tuple(terms[i].kind, terms[i].symbol, terms[i].operands)] = i;
+    }
+    states.clear();
+    stateIndices.clear();
+    table.clear();
+    finals.clear();
+    addState(EMPTY_TERM);
+    firstState = addState(firstTerm);
+}
+
+DerivativeAutomaton::DerivativeAutomaton(const std::string &expression, int _maxStates) : maxStates{_maxStates}
+{
+    if (maxStates < 4)
+    {
+        throw std::invalid_argument("The cache must hold at least 4 states");
+    }
+    // the derivatives by two chars which are not in the expression are the same
+    ByteClasses byteClasses;
+    for (int i = 0; i < expression.size(); ++i)
+    {
+        byteClasses.add(0, expression[i], (unsigned char)expression[i]);
+    }
+    byteClasses.build();
+    classes = byteClasses.getClasses();
+    classesCount = byteClasses.getClassesCount();
+    for (int i = 0; i < classesCount; ++i)
+    {
+        classChars.push_back(byteClasses.getChars(i)[0]);
+    }
+
+    addTerm(Kind::EMPTY, '\0', {});
+    addTerm(Kind::EPSILON, '\0', {});
+    addTerm(Kind::COMPLEMENT, '\0', {EMPTY_TERM});
+    firstTerm = parseExpression(expression);
+    expressionTermsCount = terms.size();
+    clearCache();
+}
+
+bool DerivativeAutomaton::isWordFromAuto(std::string_view transitionWord)
+{
+    int state = firstState;
+    for (int i = 0; i < transitionWord.size() && state != DEAD_STATE; ++i)
+    {
+        int next = table[state * classesCount + classes[(unsigned char)transitionWord[i]]];
+        state = (next != UNKNOWN_STATE) ? next : transition(state, transitionWord[i]);
+    }
+    return finals[state];
+}
+
+int DerivativeAutomaton::begin() const
+{
+    return firstState;
+}
+
+int DerivativeAutomaton::transition(int state, const char &transitionChar)
+{
+    int byteClass = classes[(unsigned char)transitionChar];
+    int cell = state * classesCount + byteClass;
+    if (table[cell] != UNKNOWN_STATE)
+    {
+        return table[cell];
+    }
+
+    int next = derivative(states[state], byteClass);
+    if (stateIndices.count(next) == 0 && states.size() >= maxStates)
+    {
+        std::vector<Term> oldTerms = terms;
+        int current = states[state];
+        clearCache();
+        state = addState(copyTerm(oldTerms, current));
+        next = copyTerm(oldTerms, next);
+        cell = state * classesCount + byteClass;
+    }
+    int nextState = addState(next);
+    table[cell] = nextState;
+    return nextState;
+}
+
+bool DerivativeAutomaton::isFinalState(int state) const
+{
+    return finals[state];
+}
+
+bool DerivativeAutomaton::isDeadState(int state) const
+{
+    return state == DEAD_STATE;
+}
+
+int DerivativeAutomaton::getCachedStatesCount() const
+{
+    return states.size();
+}
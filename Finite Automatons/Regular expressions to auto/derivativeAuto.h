@@ -0,0 +1,137 @@
+#ifndef DERIVATIVE_AUTOMATON_H
+#define DERIVATIVE_AUTOMATON_H
+#include <map>
+#include <stack>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "../Deterministic/byteClasses.h"
+
+///class DerivativeAutomaton matches words of a regular expression by taking its derivatives on demand,
+///every derivative is a deterministic state, so intersections and complements are matched without building products,
+///the expression has the syntax of Parser and x~ is the complement of x over all strings
+class DerivativeAutomaton
+{
+    ///marks a transition which is not computed yet
+    static constexpr int UNKNOWN_STATE = -1;
+
+    ///the empty language is always state 0
+    static constexpr int DEAD_STATE = 0;
+
+    ///the terms of the empty language, of the empty word and of all strings are always the first three terms
+    static constexpr int EMPTY_TERM = 0;
+    static constexpr int EPSILON_TERM = 1;
+    static constexpr int ALL_TERM = 2;
+
+    enum class Kind
+    {
+        EMPTY,
+        EPSILON,
+        SYMBOL,
+        CONCATENATION,
+        UNION,
+        INTERSECTION,
+        COMPLEMENT,
+        STAR
+    };
+
+    ///a subexpression, the operands are indices of terms added before it
+    struct Term
+    {
+        Kind kind;
+        char symbol;
+        std::vector<int> operands;
+        bool isNullable;
+    };
+
+    ///the equal terms are added once, so a term is known by its index
+    std::vector<Term> terms;
+    std::map<std::tuple<Kind, char, std::vector<int>>, int> termIndices;
+    ///the terms of the expression are never removed from the cache
+    int expressionTermsCount;
+    int firstTerm;
+    ///the derivatives of every term by every class, an empty list is not computed yet
+    std::vector<std::vector<int>> derivatives;
+
+    int maxStates;
+    int classesCount;
+    ///the class of every char, the table has a column for every class
+    std::vector<unsigned char> classes;
+    ///a char of every class used to take the derivatives
+    std::string classChars;
+
+    std::vector<int> states;
+    std::unordered_map<int, int> stateIndices;
+    std::vector<int> table;
+    std::vector<char> finals;
+    int firstState;
+
+    ///returns the term of the expression built in postfix order
+    int parseExpression(const std::string &);
+
+    ///returns the term of the string, the operation after the string is applied to its last char
+    int parseWord(const std::string &, const char &oper);
+
+    ///applies the operation to the terms on the top of the stack
+    void calculate(std::stack<int> &, const char &oper);
+
+    int popTerm(std::stack<int> &);
+
+    ///returns the index of the term and adds it if it is missing
+    int addTerm(Kind, const char &symbol, const std::vector<int> &operands);
+
+    int makeSymbol(const char &);
+
+    int makeConcatenation(int, int);
+
+    ///returns the union of the terms, the operands are sorted and repeated ones are removed
+    int makeUnion(const std::vector<int> &);
+
+    ///returns the intersection of the terms, the operands are sorted and repeated ones are removed,
+    ///the intersections with different chars, a term and its complement or the empty word and a term without it are empty
+    int makeIntersection(const std::vector<int> &);
+
+    int makeComplement(int);
+
+    int makeStar(int);
+
+    ///returns the derivative of the term by the chars of the class
+    int derivative(int term, int byteClass);
+
+    ///adds the term of the other list of terms to this one and returns its index
+    int copyTerm(const std::vector<Term> &, int);
+
+    ///returns the index of the state of the term and adds it if it is missing
+    int addState(int term);
+
+    ///removes all cached states and derivatives except the terms of the expression
+    void clearCache();
+
+public:
+    DerivativeAutomaton() = delete;
+
+    ///the cache is cleared when it reaches maxStates states, throws std::invalid_argument if the expression is invalid
+    DerivativeAutomaton(const std::string &expression, int maxStates = 10000);
+
+    ///checks whether the word is from the language of the expression
+    bool isWordFromAuto(std::string_view);
+
+    ///returns the starting state
+    int begin() const;
+
+    ///returns the state of the derivative of the state by the char and caches the transition
+    int transition(int state, const char &transitionChar);
+
+    bool isFinalState(int state) const;
+
+    ///checks whether the state is the empty term, an intersection is empty when its operands show it,
+    ///e.g. the states of a&b and a&a~, but some other states with empty languages are not dead
+    bool isDeadState(int state) const;
+
+    ///returns the number of cached deterministic states
+    int getCachedStatesCount() const;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#include <stack>
+#include "expressionTokenizer.h"
+
+bool ExpressionTokenizer::isOperation(const char &symbol) const
+{
+    return symbol == '+' || symbol == '.' || symbol == '&' || unaryOperations.find(symbol) != std::string::npos;
+}
+
+int ExpressionTokenizer::priority(const char &symbol) const
+{
+    switch (symbol)
+    {
+    case '+':
+        return 1;
+    case '&':
+        return 1;
+    case '.':
+        return 2;
+    default:
+        return isOperation(symbol) ? 3 : 0;
+    }
+}
+
+std::string ExpressionTokenizer::getString(const std::string &expression, int &index) const
+{
+    if (expression[index] == '@')
+    {
+        return "@";
+    }
+    std::string str;
+    while (index < expression.size() && expression[index] != '(' && expression[index] != ')' && !isOperation(expression[index]))
+    {
+        str.push_back(expression[index++]);
+    }
+    index--;
+    return str;
+}
+
+ExpressionTokenizer::ExpressionTokenizer(const std::string &unaryOperations) : unaryOperations{unaryOperations} {}
+
+std::vector<ExpressionTokenizer::Token> ExpressionTokenizer::tokenize(const std::string &expression) const
+{
+    std::vector<Token> tokens;
+    std::stack<char> operations;
+    for (int i = 0; i < expression.size(); i++)
+    {
+        if (isOperation(expression[i]))
+        {
+            while (!operations.empty() && priority(expression[i]) < priority(operations.top()))
+            {
+                tokens.push_back(Token{"", '\0', operations.top()});
+                operations.pop();
+            }
+            operations.push(expression[i]);
+        }
+        else if (expression[i] == '(')
+        {
+            operations.push('(');
+        }
+        else if (expression[i] == ')')
+        {
+            while (!operations.empty() && operations.top() != '(')
+            {
+                tokens.push_back(Token{"", '\0', operations.top()});
+                operations.pop();
+            }
+
+            if (!operations.empty() && operations.top() == '(')
+            {
+                operations.pop();
+            }
+        }
+        else
+        {
+            std::string str = getString(expression, i);
+            if (i + 1 < expression.size() && unaryOperations.find(expression[i + 1]) != std::string::npos)
+            {
+                tokens.push_back(Token{str, expression[++i], '\0'});
+            }
+            else
+            {
+                tokens.push_back(Token{str, '\0', '\0'});
+            }
+        }
+    }
+
+    while (!operations.empty())
+    {
+        if (operations.top() != '(')
+        {
+            tokens.push_back(Token{"", '\0', operations.top()});
+        }
+        operations.pop();
+    }
+    return tokens;
+}
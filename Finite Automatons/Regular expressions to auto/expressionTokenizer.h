@@ -0,0 +1,38 @@
+#ifndef EXPRESSION_TOKENIZER_H
+#define EXPRESSION_TOKENIZER_H
+#include <string>
+#include <vector>
+
+///class ExpressionTokenizer splits a regular expression to its strings and operations in postfix order,
+///+ and & have the lowest priority, . is next and the unary operations written after their operands have the highest one
+class ExpressionTokenizer
+{
+public:
+    ///a string of chars or an operation of the expression
+    struct Token
+    {
+        std::string word;
+        ///the unary operation written right after the string, it is applied only to its last char, '\0' if there is none
+        char lastCharOperation;
+        ///the operation of the token, '\0' if the token is a string
+        char operation;
+    };
+
+private:
+    ///the chars of the unary operations, they are chars of the strings for the parsers which do not support them
+    std::string unaryOperations;
+
+    bool isOperation(const char &symbol) const;
+
+    int priority(const char &symbol) const;
+
+    ///returns the substring before the next operation char or the end of the string
+    std::string getString(const std::string &, int &) const;
+
+public:
+    ExpressionTokenizer(const std::string &unaryOperations = "*");
+
+    ///returns the strings and the operations of the expression in postfix order, the unclosed brackets are skipped
+    std::vector<Token> tokenize(const std::string &expression) const;
+};
+#endif
@@ -0,0 +1,211 @@
+#include <stdexcept>
+#include "glushkovParser.h"
+#include "../Nondeterministic/autoBuilder.h"
+
+int GlushkovParser::addPosition()
+{
+    follows.emplace_back();
+    return follows.size() - 1;
+}
+
+GlushkovParser::Term GlushkovParser::calculateWord(const ExpressionTokenizer::Token &token)
+{
+    std::string word = token.word;
+    bool isStarred = token.lastCharOperation == '*';
+    if (isStarred && word.back() == '@')
+    {
+        // as in Parser the repeated @ is epsilon and its star is epsilon too
+        word.pop_back();
+        isStarred = false;
+    }
+    if (word.empty() || word.compare("@") == 0)
+    {
+        return Term{true, {}, {}};
+    }
+
+    Term myTerm{true, {}, {}};
+    for (int i = 0; i < word.size(); ++i)
+    {
+        int position = addPosition();
+        if (myTerm.lasts.empty())
+        {
+            myTerm.firsts.push_back(std::pair(word[i], position));
+        }
+        for (int k = 0; k < myTerm.lasts.size(); ++k)
+        {
+            follows[myTerm.lasts[k]].push_back(std::pair(word[i], position));
+        }
+        bool isRepeated = isStarred && i == word.size() - 1;
+        if (isRepeated)
+        {
+            follows[position].push_back(std::pair(word[i], position));
+            myTerm.lasts.push_back(position);
+        }
+        else
+        {
+            myTerm.isNullable = false;
+            myTerm.lasts = {position};
+        }
+    }
+    return myTerm;
+}
+
+GlushkovParser::Term GlushkovParser::calculate(const Term &first, const Term &second, const char &oper)
+{
+    switch (oper)
+    {
+    case '+':
+    {
+        Term myTerm = second;
+        myTerm.isNullable = first.isNullable || second.isNullable;
+        myTerm.firsts.insert(myTerm.firsts.end(), first.firsts.begin(), first.firsts.end());
+        myTerm.lasts.insert(myTerm.lasts.end(), first.lasts.begin(), first.lasts.end());
+        return myTerm;
+    }
+    case '&':
+        // there is no position automaton of an intersection, so the product of the operands becomes new positions
+        return addAuto(NondetermAutomaton::intersection(buildAuto(first), buildAuto(second)));
+
+    case '.':
+    {
+        for (int i = 0; i < second.lasts.size(); ++i)
+        {
+            std::vector<std::pair<char, int>> &nexts = follows[second.lasts[i]];
+            nexts.insert(nexts.end(), first.firsts.begin(), first.firsts.end());
+        }
+        Term myTerm{second.isNullable && first.isNullable, second.firsts, first.lasts};
+        if (second.isNullable)
+        {
+            myTerm.firsts.insert(myTerm.firsts.end(), first.firsts.begin(), first.firsts.end());
+        }
+        if (first.isNullable)
+        {
+            myTerm.lasts.insert(myTerm.lasts.end(), second.lasts.begin(), second.lasts.end());
+        }
+        return myTerm;
+    }
+
+    default:
+        return Term{true, {}, {}};
+    }
+}
+
+GlushkovParser::Term GlushkovParser::calculateKleeneStar(const Term &first)
+{
+    for (int i = 0; i < first.lasts.size(); ++i)
+    {
+        std::vector<std::pair<char, int>> &nexts = follows[first.lasts[i]];
+        nexts.insert(nexts.end(), first.firsts.begin(), first.firsts.end());
+    }
+    Term myTerm = first;
+    myTerm.isNullable = true;
+    return myTerm;
+}
+
+GlushkovParser::Term GlushkovParser::addAuto(const NondetermAutomaton &myAuto)
+{
+    int offset = follows.size();
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
+    {
+        int position = addPosition();
+        const std::vector<std::pair<std::optional<char>, int>> &nexts = myAuto.nodes[i].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
+        {
+            follows[position].push_back(std::pair(*nexts[k].first, offset + nexts[k].second));
+        }
+    }
+
+    Term myTerm{myAuto.finals[myAuto.first], follows[offset + myAuto.first], {}};
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
+    {
+        if (myAuto.finals[i])
+        {
+            myTerm.lasts.push_back(offset + i);
+        }
+    }
+    return myTerm;
+}
+
+NondetermAutomaton GlushkovParser::buildAuto(const Term &myTerm) const
+{
+    // the first state is numbered 0 and the positions are numbered in the order they are reached
+    std::vector<int> listOfStates(follows.size(), NondetermAutomaton::NO_NODE);
+    std::vector<int> listOfPositions{NondetermAutomaton::NO_NODE};
+    AutoBuilder builder(1);
+    builder.setFirst(0);
+    for (int i = 0; i < listOfPositions.size(); ++i)
+    {
+        const std::vector<std::pair<char, int>> &nexts = i == 0 ? myTerm.firsts : follows[listOfPositions[i]];
+        for (int k = 0; k < nexts.size(); ++k)
+        {
+            if (listOfStates[nexts[k].second] == NondetermAutomaton::NO_NODE)
+            {
+                listOfStates[nexts[k].second] = builder.addState();
+                listOfPositions.push_back(nexts[k].second);
+            }
+            builder.addTransition(i, nexts[k].first, listOfStates[nexts[k].second]);
+        }
+    }
+
+    if (myTerm.isNullable)
+    {
+        builder.addFinal(0);
+    }
+    for (int i = 0; i < myTerm.lasts.size(); ++i)
+    {
+        if (listOfStates[myTerm.lasts[i]] != NondetermAutomaton::NO_NODE)
+        {
+            builder.addFinal(listOfStates[myTerm.lasts[i]]);
+        }
+    }
+    return builder.toNondetermAutomaton();
+}
+
+GlushkovParser::Term GlushkovParser::popTerm()
+{
+    if (terms.empty())
+    {
+        throw std::invalid_argument("Invalid regular expression");
+    }
+    Term myTerm = terms.top();
+    terms.pop();
+    return myTerm;
+}
+
+GlushkovParser::GlushkovParser(const std::string &str) : expression{str} {}
+
+NondetermAutomaton GlushkovParser::solve()
+{
+    parsedString = ExpressionTokenizer().tokenize(expression);
+    follows.clear();
+    while (!terms.empty())
+    {
+        terms.pop();
+    }
+
+    for (int i = 0; i < parsedString.size(); i++)
+    {
+        if (parsedString[i].operation == '\0')
+        {
+            terms.push(calculateWord(parsedString[i]));
+        }
+        else
+        {
+            Term one = popTerm();
+
+            if (parsedString[i].operation == '*')
+            {
+                terms.push(calculateKleeneStar(one));
+            }
+            else
+            {
+                Term two = popTerm();
+                terms.push(calculate(one, two, parsedString[i].operation));
+            }
+        }
+    }
+
+    NondetermAutomaton myAuto = buildAuto(popTerm());
+    follows.clear();
+    return myAuto;
+}
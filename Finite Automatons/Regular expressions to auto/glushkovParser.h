@@ -0,0 +1,56 @@
+#ifndef GLUSHKOV_PARSER_H
+#define GLUSHKOV_PARSER_H
+
+#include <string>
+#include <stack>
+#include <utility>
+#include <vector>
+#include "../Nondeterministic/nondetermAuto.h"
+#include "expressionTokenizer.h"
+
+///class GlushkovParser parses a regular expression to its position automaton which has no epsilon transitions,
+///every occurrence of a char in the expression is a state and the first state is the only other one
+class GlushkovParser
+{
+    ///the positions of a subexpression, the transitions are pairs of a char and the position they lead to
+    struct Term
+    {
+        bool isNullable;
+        std::vector<std::pair<char, int>> firsts;
+        std::vector<int> lasts;
+    };
+
+    std::string expression;
+    ///the strings and the operations of the expression in postfix order
+    std::vector<ExpressionTokenizer::Token> parsedString;
+    ///the transitions from every position, the first state is not a position and its transitions are the firsts of the expression
+    std::vector<std::vector<std::pair<char, int>>> follows;
+    std::stack<Term> terms;
+
+    int addPosition();
+
+    ///adds the positions of the string, the last char is repeated if the string is starred
+    Term calculateWord(const ExpressionTokenizer::Token &);
+
+    ///gets two terms and returns the result of the operation on them
+    Term calculate(const Term &first, const Term &second, const char &oper);
+
+    Term calculateKleeneStar(const Term &);
+
+    ///adds a position for every node of the auto without epsilon transitions and returns their term
+    Term addAuto(const NondetermAutomaton &);
+
+    ///returns the auto of the positions reachable from the firsts of the term
+    NondetermAutomaton buildAuto(const Term &) const;
+
+    Term popTerm();
+
+public:
+    GlushkovParser() = delete;
+
+    GlushkovParser(const std::string &str);
+
+    ///returns the position automaton of the expression, the intersections are built as products of the position autos of the operands
+    NondetermAutomaton solve();
+};
+#endif
@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <cstring>
+#include <stack>
+#include <stdexcept>
+#include "literalPrefilter.h"
+#include "expressionTokenizer.h"
+#include "regExpressionParser.h"
+
+LiteralPrefilter::Literals LiteralPrefilter::exactLiterals(const std::string &word)
+{
+    return Literals{true, word, word, word};
+}
+
+const std::string &LiteralPrefilter::longest(const std::string &first, const std::string &second)
+{
+    return first.size() >= second.size() ? first : second;
+}
+
+LiteralPrefilter::Literals LiteralPrefilter::calculate(const Literals &first, const Literals &second, const char &oper)
+{
+    switch (oper)
+    {
+    case '+':
+    {
+        int prefixSize = 0;
+        while (prefixSize < first.prefix.size() && prefixSize < second.prefix.size() &&
+               first.prefix[prefixSize] == second.prefix[prefixSize])
+        {
+            ++prefixSize;
+        }
+        int suffixSize = 0;
+        while (suffixSize < first.suffix.size() && suffixSize < second.suffix.size() &&
+               first.suffix[first.suffix.size() - 1 - suffixSize] == second.suffix[second.suffix.size() - 1 - suffixSize])
+        {
+            ++suffixSize;
+        }
+        Literals myLiterals{first.isExact && second.isExact && first.prefix == second.prefix,
+                            first.prefix.substr(0, prefixSize), first.suffix.substr(first.suffix.size() - suffixSize), ""};
+        myLiterals.factor = longest(myLiterals.prefix, myLiterals.suffix);
+        if (first.factor == second.factor)
+        {
+            myLiterals.factor = longest(myLiterals.factor, first.factor);
+        }
+        return myLiterals;
+    }
+    case '&':
+    {
+        // the words are from both languages, so they have the literals of both
+        if (first.isExact || second.isExact)
+        {
+            return first.isExact ? first : second;
+        }
+        return Literals{false, longest(first.prefix, second.prefix), longest(first.suffix, second.suffix),
+                        longest(first.factor, second.factor)};
+    }
+    case '.':
+    {
+        // as in Parser the second literals are of the left operand
+        Literals myLiterals{second.isExact && first.isExact,
+                            second.isExact ? second.prefix + first.prefix : second.prefix,
+                            first.isExact ? second.suffix + first.suffix : first.suffix, ""};
+        myLiterals.factor = longest(longest(second.factor, first.factor), second.suffix + first.prefix);
+        return myLiterals;
+    }
+    default:
+        return Literals{false, "", "", ""};
+    }
+}
+
+LiteralPrefilter::LiteralPrefilter(const std::string &expression) : longestWordSize{0}
+{
+    std::vector<ExpressionTokenizer::Token> tokens = ExpressionTokenizer().tokenize(expression);
+    std::stack<Literals> literals;
+    for (int i = 0; i < tokens.size(); i++)
+    {
+        const ExpressionTokenizer::Token &token = tokens[i];
+        if (token.operation == '\0')
+        {
+            std::string word = token.word;
+            if (word.compare("@") == 0)
+            {
+                literals.push(exactLiterals(""));
+            }
+            else if (token.lastCharOperation == '*' && word.back() != '@')
+            {
+                word.pop_back();
+                literals.push(Literals{false, word, "", word});
+            }
+            else
+            {
+                // as in Parser the repeated @ is epsilon
+                if (token.lastCharOperation == '*')
+                {
+                    word.pop_back();
+                }
+                literals.push(exactLiterals(word));
+            }
+            continue;
+        }
+
+        if (literals.empty())
+        {
+            throw std::invalid_argument("Invalid regular expression");
+        }
+        Literals one = literals.top();
+        literals.pop();
+        if (token.operation == '*')
+        {
+            // the star of a language has the empty word, so no literal is required
+            literals.push(Literals{false, "", "", ""});
+            continue;
+        }
+        if (literals.empty())
+        {
+            throw std::invalid_argument("Invalid regular expression");
+        }
+        Literals two = literals.top();
+        literals.pop();
+        literals.push(calculate(one, two, token.operation));
+    }
+
+    if (literals.empty())
+    {
+        throw std::invalid_argument("Invalid regular expression");
+    }
+    prefix = literals.top().prefix;
+    suffix = literals.top().suffix;
+    factor = literals.top().factor;
+
+    std::string myExpression = expression;
+    std::optional<std::vector<std::string>> literalWords = Parser(myExpression).getLiteralWords();
+    if (!literalWords || literalWords->size() < 2)
+    {
+        return;
+    }
+    for (int i = 0; i < literalWords->size(); ++i)
+    {
+        // the empty word is found at every position
+        if ((*literalWords)[i].empty())
+        {
+            return;
+        }
+        longestWordSize = std::max(longestWordSize, (int)(*literalWords)[i].size());
+    }
+    words.emplace(*literalWords);
+}
+
+const std::string &LiteralPrefilter::getPrefix() const
+{
+    return prefix;
+}
+
+const std::string &LiteralPrefilter::getSuffix() const
+{
+    return suffix;
+}
+
+const std::string &LiteralPrefilter::getFactor() const
+{
+    return factor;
+}
+
+std::size_t LiteralPrefilter::findLiteral(std::string_view text, const std::string &literal, std::size_t from)
+{
+    if (from > text.size())
+    {
+        return std::string_view::npos;
+    }
+    if (literal.empty())
+    {
+        return from;
+    }
+    // memchr jumps to the first char of the literal and only there the rest is compared
+    std::size_t lastStart = text.size() - literal.size();
+    while (text.size() >= literal.size() && from <= lastStart)
+    {
+        const void *found = std::memchr(text.data() + from, literal[0], lastStart - from + 1);
+        if (!found)
+        {
+            return std::string_view::npos;
+        }
+        std::size_t position = static_cast<const char *>(found) - text.data();
+        if (std::memcmp(text.data() + position + 1, literal.data() + 1, literal.size() - 1) == 0)
+        {
+            return position;
+        }
+        from = position + 1;
+    }
+    return std::string_view::npos;
+}
+
+std::size_t LiteralPrefilter::findCandidate(std::string_view text, std::size_t from) const
+{
+    if (!words)
+    {
+        return findLiteral(text, prefix, from);
+    }
+    // a word which starts before the first found word ends after it, so it is at most as long as the longest word
+    int state = words->begin();
+    for (std::size_t i = from; i < text.size(); ++i)
+    {
+        state = words->transition(state, text[i]);
+        if (words->isFinalState(state))
+        {
+            return i + 1 >= from + longestWordSize ? i + 1 - longestWordSize : from;
+        }
+    }
+    return std::string_view::npos;
+}
+
+bool LiteralPrefilter::mayContain(std::string_view text) const
+{
+    if (words)
+    {
+        return findCandidate(text, 0) != std::string_view::npos;
+    }
+    return findLiteral(text, factor, 0) != std::string_view::npos;
+}
+
+bool LiteralPrefilter::mayBeWord(std::string_view word) const
+{
+    if (words)
+    {
+        return words->isWordFromAuto(word);
+    }
+    return word.size() >= prefix.size() && word.size() >= suffix.size() &&
+           word.compare(0, prefix.size(), prefix) == 0 &&
+           word.compare(word.size() - suffix.size(), suffix.size(), suffix) == 0 &&
+           findLiteral(word, factor, 0) != std::string_view::npos;
+}
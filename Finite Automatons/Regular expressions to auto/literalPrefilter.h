@@ -0,0 +1,65 @@
+#ifndef LITERAL_PREFILTER_H
+#define LITERAL_PREFILTER_H
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "../Search/ahoCorasick.h"
+
+///class LiteralPrefilter keeps the literals which every word of a regular expression contains,
+///so the texts and the positions which can not match are skipped with memchr before running an automaton,
+///a union of words has no common literals, so its words are searched all at once with their Aho-Corasick auto
+class LiteralPrefilter
+{
+    ///the literals of a subexpression, if it has only one word they are all that word
+    struct Literals
+    {
+        bool isExact;
+        std::string prefix;
+        std::string suffix;
+        ///a literal inside every word, the longest one found
+        std::string factor;
+    };
+
+    std::string prefix;
+    std::string suffix;
+    std::string factor;
+    ///the words of an expression which is a union of at least two nonempty words
+    std::optional<AhoCorasickAutomaton> words;
+    int longestWordSize;
+
+    static Literals exactLiterals(const std::string &);
+
+    ///gets two literals and returns the literals of the result of the operation on them
+    static Literals calculate(const Literals &first, const Literals &second, const char &oper);
+
+    static const std::string &longest(const std::string &, const std::string &);
+
+public:
+    ///the literals are computed from the expression with the syntax of Parser,
+    ///throws std::invalid_argument if the expression is invalid
+    LiteralPrefilter(const std::string &expression);
+
+    ///returns the prefix of every word of the language
+    const std::string &getPrefix() const;
+
+    ///returns the suffix of every word of the language
+    const std::string &getSuffix() const;
+
+    ///returns a literal inside every word of the language
+    const std::string &getFactor() const;
+
+    ///returns the first position from the index at which the literal is in the text or std::string_view::npos
+    static std::size_t findLiteral(std::string_view text, const std::string &literal, std::size_t from);
+
+    ///returns the first position from the index at which a word of the language can start or std::string_view::npos
+    std::size_t findCandidate(std::string_view text, std::size_t from) const;
+
+    ///checks whether a word of the language can be inside the text
+    bool mayContain(std::string_view text) const;
+
+    ///checks whether the word has all the literals of the language
+    bool mayBeWord(std::string_view word) const;
+};
+
+#endif
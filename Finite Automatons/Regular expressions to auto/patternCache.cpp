@@ -0,0 +1,205 @@
+#include "patternCache.h"
+#include "regExpressionParser.h"
+
+PatternCache::PatternCache(std::size_t _maxMemory)
+    : maxMemory{_maxMemory}, memoryUsage{0}, hits{0}, misses{0}, evictions{0} {}
+
+PatternCache &PatternCache::getGlobal()
+{
+    static PatternCache cache;
+    return cache;
+}
+
+std::list<PatternCache::Entry>::iterator PatternCache::findEntry(const std::string &expression)
+{
+    auto found = entryIndices.find(expression);
+    if (found == entryIndices.end())
+    {
+        return entries.end();
+    }
+    entries.splice(entries.begin(), entries, found->second);
+    return found->second;
+}
+
+std::list<PatternCache::Entry>::iterator PatternCache::getEntry(const std::string &expression, std::unique_lock<std::mutex> &lock)
+{
+    auto found = findEntry(expression);
+    if (found != entries.end())
+    {
+        return found;
+    }
+    lock.unlock();
+    std::string text = expression;
+    Parser parser(text);
+    std::shared_ptr<const NondetermAutomaton> myAuto = std::make_shared<const NondetermAutomaton>(parser.solve());
+    std::size_t memory = estimateMemory(*myAuto);
+    lock.lock();
+
+    // another thread could have parsed the same expression while the lock was released
+    found = findEntry(expression);
+    if (found != entries.end())
+    {
+        return found;
+    }
+    entries.push_front(Entry{expression, myAuto, nullptr, nullptr, 0});
+    entryIndices[expression] = entries.begin();
+    addMemory(entries.begin(), memory + expression.size() * 2);
+    return entries.begin();
+}
+
+void PatternCache::addMemory(std::list<Entry>::iterator entry, std::size_t memory)
+{
+    entry->memory += memory;
+    memoryUsage += memory;
+    evict();
+}
+
+void PatternCache::evict()
+{
+    while (memoryUsage > maxMemory && entries.size() > 1)
+    {
+        memoryUsage -= entries.back().memory;
+        entryIndices.erase(entries.back().expression);
+        entries.pop_back();
+        ++evictions;
+    }
+}
+
+std::shared_ptr<const NondetermAutomaton> PatternCache::getNondetermAutomaton(const std::string &expression)
+{
+    return getNondetermHelper(expression, true);
+}
+
+std::shared_ptr<const DetermAutomaton> PatternCache::getDetermAutomaton(const std::string &expression)
+{
+    return getDetermHelper(expression, false, true);
+}
+
+std::shared_ptr<const DetermAutomaton> PatternCache::getMinimalAutomaton(const std::string &expression)
+{
+    return getDetermHelper(expression, true, true);
+}
+
+std::shared_ptr<const NondetermAutomaton> PatternCache::getNondetermHelper(const std::string &expression, bool isCounted)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (isCounted && findEntry(expression) != entries.end())
+    {
+        ++hits;
+    }
+    else if (isCounted)
+    {
+        ++misses;
+    }
+    return getEntry(expression, lock)->nondeterm;
+}
+
+std::shared_ptr<const DetermAutomaton> PatternCache::getDetermHelper(const std::string &expression, bool isMinimal, bool isCounted)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto found = findEntry(expression);
+    if (found != entries.end() && (isMinimal ? found->minimal : found->determ) != nullptr)
+    {
+        if (isCounted)
+        {
+            ++hits;
+        }
+        return isMinimal ? found->minimal : found->determ;
+    }
+    if (isCounted)
+    {
+        ++misses;
+    }
+    lock.unlock();
+
+    // the auto is built from the cached auto it depends on without holding the lock
+    std::shared_ptr<const DetermAutomaton> myAuto;
+    if (isMinimal)
+    {
+        myAuto = std::make_shared<const DetermAutomaton>(getDetermHelper(expression, false, false)->minimize());
+    }
+    else
+    {
+        myAuto = std::make_shared<const DetermAutomaton>(getNondetermHelper(expression, false)->determinize());
+    }
+    std::size_t memory = estimateMemory(*myAuto);
+
+    lock.lock();
+    found = getEntry(expression, lock);
+    std::shared_ptr<const DetermAutomaton> &cached = isMinimal ? found->minimal : found->determ;
+    if (cached == nullptr)
+    {
+        cached = myAuto;
+        addMemory(found, memory);
+    }
+    return cached;
+}
+
+void PatternCache::setMaxMemory(std::size_t _maxMemory)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxMemory = _maxMemory;
+    evict();
+}
+
+void PatternCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    entryIndices.clear();
+    memoryUsage = 0;
+}
+
+std::uint64_t PatternCache::getHits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+std::uint64_t PatternCache::getMisses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+std::uint64_t PatternCache::getEvictions() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return evictions;
+}
+
+std::size_t PatternCache::getMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return memoryUsage;
+}
+
+int PatternCache::getSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+std::size_t PatternCache::estimateMemory(const NondetermAutomaton &myAuto)
+{
+    // every name holds at least one shared part of a few words
+    std::size_t memory = sizeof(NondetermAutomaton) + myAuto.finals.size() / 8 + myAuto.nameIndices.size() * 64;
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
+    {
+        memory += sizeof(NondetermAutomaton::Node) + sizeof(StateName) + 64;
+        memory += myAuto.nodes[i].getNext().capacity() * sizeof(std::pair<std::optional<char>, int>);
+    }
+    return memory;
+}
+
+std::size_t PatternCache::estimateMemory(const DetermAutomaton &myAuto)
+{
+    std::size_t memory = sizeof(DetermAutomaton) + myAuto.finals.size() / 8 + myAuto.finalNodes.size() * sizeof(int) +
+                         myAuto.nameIndices.size() * 64;
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
+    {
+        memory += sizeof(DetermAutomaton::Node) + sizeof(StateName) + 64;
+        memory += myAuto.nodes[i].getNext().capacity() * sizeof(std::pair<char, int>);
+    }
+    return memory;
+}
@@ -0,0 +1,95 @@
+#ifndef PATTERN_CACHE_H
+#define PATTERN_CACHE_H
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "../Deterministic/determAuto.h"
+#include "../Nondeterministic/nondetermAuto.h"
+
+///class PatternCache keeps the automatons compiled from regular expressions and evicts the least recently used ones
+///when their memory exceeds the limit, the cached automatons are shared and stay valid after they are evicted
+class PatternCache
+{
+    static constexpr std::size_t DEFAULT_MAX_MEMORY = 64 * 1024 * 1024;
+
+    struct Entry
+    {
+        std::string expression;
+        std::shared_ptr<const NondetermAutomaton> nondeterm;
+        std::shared_ptr<const DetermAutomaton> determ;
+        std::shared_ptr<const DetermAutomaton> minimal;
+        std::size_t memory;
+    };
+
+    ///the most recently used entry is the first one
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entryIndices;
+    std::size_t maxMemory;
+    std::size_t memoryUsage;
+    std::uint64_t hits;
+    std::uint64_t misses;
+    std::uint64_t evictions;
+    mutable std::mutex mutex;
+
+    ///returns the entry of the expression moved to the front or entries.end(), the mutex must be locked
+    std::list<Entry>::iterator findEntry(const std::string &);
+
+    ///returns the entry of the expression and parses the expression if it is not cached, the lock is released while parsing
+    std::list<Entry>::iterator getEntry(const std::string &, std::unique_lock<std::mutex> &);
+
+    ///adds the memory to the entry and evicts the least recently used other entries until the memory fits,
+    ///the mutex must be locked
+    void addMemory(std::list<Entry>::iterator, std::size_t);
+
+    ///evicts the least recently used entries except the first one until the memory fits, the mutex must be locked
+    void evict();
+
+    std::shared_ptr<const NondetermAutomaton> getNondetermHelper(const std::string &, bool isCounted);
+
+    std::shared_ptr<const DetermAutomaton> getDetermHelper(const std::string &, bool isMinimal, bool isCounted);
+
+    static std::size_t estimateMemory(const NondetermAutomaton &);
+
+    static std::size_t estimateMemory(const DetermAutomaton &);
+
+public:
+    PatternCache(std::size_t maxMemory = DEFAULT_MAX_MEMORY);
+
+    PatternCache(const PatternCache &) = delete;
+
+    PatternCache &operator=(const PatternCache &) = delete;
+
+    ///returns the cache shared by the whole process
+    static PatternCache &getGlobal();
+
+    ///returns the auto parsed from the expression, the expression is parsed only if it is not cached
+    std::shared_ptr<const NondetermAutomaton> getNondetermAutomaton(const std::string &expression);
+
+    ///returns the determinized auto of the expression, it is built once per cached expression
+    std::shared_ptr<const DetermAutomaton> getDetermAutomaton(const std::string &expression);
+
+    ///returns the minimal deterministic auto of the expression, it is built once per cached expression
+    std::shared_ptr<const DetermAutomaton> getMinimalAutomaton(const std::string &expression);
+
+    ///sets the limit of the memory and evicts entries until it fits
+    void setMaxMemory(std::size_t);
+
+    void clear();
+
+    std::uint64_t getHits() const;
+
+    std::uint64_t getMisses() const;
+
+    std::uint64_t getEvictions() const;
+
+    ///returns the estimated memory of the cached automatons in bytes
+    std::size_t getMemoryUsage() const;
+
+    int getSize() const;
+};
+
+#endif
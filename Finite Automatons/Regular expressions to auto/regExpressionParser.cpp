@@ -1,126 +1,152 @@
+#include <stdexcept>
 #include "regExpressionParser.h"
+#include "expressionTokenizer.h"
+#include "../Search/ahoCorasick.h"
 
-bool Parser::isOperation(const char &symbol)
-{
-    return symbol == '+' || symbol == '.' || symbol == '*' || symbol == '&';
-}
-
-int Parser::priority(const char &symbol)
-{
-    switch (symbol)
-    {
-    case '+':
-        return 1;
-    case '&':
-        return 1;
-    case '.':
-        return 2;
-    case '*':
-        return 3;
-    default:
-        return 0;
-    }
-}
-
-NondetermAutomaton Parser::calculate(NondetermAutomaton &first, NondetermAutomaton &second, const char &oper)
+Parser::Fragment Parser::calculate(const Fragment &first, const Fragment &second, const char &oper)
 {
     switch (oper)
     {
     case '+':
-        return (NondetermAutomaton::unions(first, second));
+    {
+        Fragment myFragment{addGraphNode(), addGraphNode()};
+        graph.nodes[myFragment.first].append(std::nullopt, first.first);
+        graph.nodes[myFragment.first].append(std::nullopt, second.first);
+        graph.nodes[first.last].append(std::nullopt, myFragment.last);
+        graph.nodes[second.last].append(std::nullopt, myFragment.last);
+        return myFragment;
+    }
     case '&':
-        return NondetermAutomaton::intersection(first, second);
+    {
+        // the product can not be built from epsilon transitions, so only the two operands are copied out of the graph
+        NondetermAutomaton myAuto = NondetermAutomaton::intersection(extractFragment(first), extractFragment(second));
+        return addFragment(myAuto);
+    }
     case '.':
-        return (NondetermAutomaton::concatenation(second, first));
+        graph.nodes[second.last].append(std::nullopt, first.first);
+        return Fragment{second.first, first.last};
 
     default:
-        return NondetermAutomaton("@");
+    {
+        NondetermAutomaton myAuto("@");
+        return addFragment(myAuto);
+    }
     }
 }
 
-NondetermAutomaton Parser::calculateKleeneStar(NondetermAutomaton &first)
+Parser::Fragment Parser::calculateKleeneStar(const Fragment &first)
 {
-    return NondetermAutomaton::kleeneStar(first);
+    int node = addGraphNode();
+    graph.nodes[node].append(std::nullopt, first.first);
+    graph.nodes[first.last].append(std::nullopt, node);
+    return Fragment{node, node};
 }
 
-Parser::Parser(std::string &str) : expression{str} {}
-
-std::vector<std::pair<std::optional<NondetermAutomaton>, std::optional<char>>> Parser::parse()
+Parser::Fragment Parser::addFragment(NondetermAutomaton &myAuto)
 {
-    for (int i = 0; i < expression.size(); i++)
+    int offset = graph.appendNodes(myAuto);
+    std::vector<int> finalNodes;
+    for (int i = 0; i < myAuto.nodes.size(); ++i)
     {
-        if (isOperation(expression[i]))
+        if (myAuto.finals[i])
         {
-            while (!operations.empty() && priority(expression[i]) < priority(operations.top()))
-            {
-                parsedString.push_back(std::pair(std::nullopt, operations.top()));
-                operations.pop();
-            }
-            operations.push(expression[i]);
-        }
-        else if (expression[i] == '(')
-        {
-            operations.push('(');
+            finalNodes.push_back(offset + i);
         }
-        else if (expression[i] == ')')
-        {
-            while (!operations.empty() && operations.top() != '(')
-            {
-                parsedString.push_back(std::pair(std::nullopt, operations.top()));
-                operations.pop();
-            }
+    }
+    if (finalNodes.size() == 1)
+    {
+        return Fragment{offset + myAuto.first, finalNodes[0]};
+    }
+    int last = addGraphNode();
+    for (int i = 0; i < finalNodes.size(); ++i)
+    {
+        graph.nodes[finalNodes[i]].append(std::nullopt, last);
+    }
+    return Fragment{offset + myAuto.first, last};
+}
 
-            if (!operations.empty() && operations.top() == '(')
-            {
-                operations.pop();
-            }
-        }
-        else
+int Parser::addGraphNode()
+{
+    return graph.addNode(StateName::withSuffix(StateName("unique"), "#" + std::to_string(graph.nodes.size())));
+}
+
+NondetermAutomaton Parser::extractFragment(const Fragment &myFragment) const
+{
+    std::vector<int> listOfNodes{myFragment.first};
+    std::vector<int> listOfIndices(graph.nodes.size(), NondetermAutomaton::NO_NODE);
+    listOfIndices[myFragment.first] = 0;
+    NondetermAutomaton myAuto;
+    for (int i = 0; i < listOfNodes.size(); ++i)
+    {
+        myAuto.addNode(graph.names[listOfNodes[i]]);
+        const std::vector<std::pair<std::optional<char>, int>> &nexts = graph.nodes[listOfNodes[i]].getNext();
+        for (int k = 0; k < nexts.size(); ++k)
         {
-            std::string str = getString(expression, i);
-            if (expression[++i] == '*')
-            {
-                std::string repeatedSymbol = str.substr(str.size() - 1, 1);
-                str.pop_back();
-                NondetermAutomaton charAuto(repeatedSymbol);
-                NondetermAutomaton stringAuto(str);
-                NondetermAutomaton kleeneAuto = NondetermAutomaton::kleeneStar(charAuto);
-
-                parsedString.push_back(std::pair(NondetermAutomaton::concatenation(stringAuto,
-                                                                                   kleeneAuto),
-                                                 std::nullopt));
-            }
-            else
+            if (listOfIndices[nexts[k].second] == NondetermAutomaton::NO_NODE)
             {
-                --i;
-                parsedString.push_back(std::pair(NondetermAutomaton(str), std::nullopt));
+                listOfIndices[nexts[k].second] = listOfNodes.size();
+                listOfNodes.push_back(nexts[k].second);
             }
+            myAuto.nodes[i].append(nexts[k].first, listOfIndices[nexts[k].second]);
         }
     }
+    myAuto.first = 0;
+    if (listOfIndices[myFragment.last] == NondetermAutomaton::NO_NODE)
+    {
+        // the language of the fragment is empty, but the auto still needs its final node
+        listOfIndices[myFragment.last] = myAuto.addNode(graph.names[myFragment.last]);
+    }
+    myAuto.finals[listOfIndices[myFragment.last]] = true;
+    return myAuto;
+}
 
-    while (!operations.empty())
+Parser::Fragment Parser::popFragment()
+{
+    if (fragments.empty())
     {
-        parsedString.push_back(std::pair(std::nullopt, operations.top()));
-        operations.pop();
+        throw std::invalid_argument("Invalid regular expression");
     }
+    Fragment myFragment = fragments.top();
+    fragments.pop();
+    return myFragment;
+}
+
+Parser::Parser(std::string &str) : expression{str} {}
 
+std::vector<std::pair<std::optional<NondetermAutomaton>, std::optional<char>>> Parser::parse()
+{
+    parseExpression();
     return parsedString;
 }
 
-std::string Parser::getString(const std::string &expression, int &index)
+void Parser::parseExpression()
 {
-
-    if (expression[index] == '@')
-    {
-        return "@";
-    }
-    std::string str;
-    while (index < expression.size() && expression[index] != '(' && expression[index] != ')' && !isOperation(expression[index]))
+    parsedString.clear();
+    std::vector<ExpressionTokenizer::Token> tokens = ExpressionTokenizer().tokenize(expression);
+    for (int i = 0; i < tokens.size(); i++)
     {
-        str.push_back(expression[index++]);
+        if (tokens[i].operation != '\0')
+        {
+            parsedString.push_back(std::pair(std::nullopt, tokens[i].operation));
+        }
+        else if (tokens[i].lastCharOperation == '*')
+        {
+            std::string str = tokens[i].word;
+            std::string repeatedSymbol = str.substr(str.size() - 1, 1);
+            str.pop_back();
+            NondetermAutomaton charAuto(repeatedSymbol);
+            NondetermAutomaton stringAuto(str);
+            NondetermAutomaton kleeneAuto = NondetermAutomaton::kleeneStar(charAuto);
+
+            parsedString.push_back(std::pair(NondetermAutomaton::concatenation(stringAuto,
+                                                                               kleeneAuto),
+                                             std::nullopt));
+        }
+        else
+        {
+            parsedString.push_back(std::pair(NondetermAutomaton(tokens[i].word), std::nullopt));
+        }
     }
-    index--;
-    return str;
 }
 
 bool Parser::isAuto(const std::pair<std::optional<NondetermAutomaton>, std::optional<char>> &myPair)
@@ -128,39 +154,75 @@ bool Parser::isAuto(const std::pair<std::optional<NondetermAutomaton>, std::opti
     return (bool)(myPair.first);
 }
 
+std::optional<std::vector<std::string>> Parser::getLiteralWords()
+{
+    // in postfix order the expression is a union of words when every union has two operands before it
+    std::vector<ExpressionTokenizer::Token> tokens = ExpressionTokenizer().tokenize(expression);
+    std::vector<std::string> words;
+    int operandsCount = 0;
+    for (int i = 0; i < tokens.size(); i++)
+    {
+        if (tokens[i].operation == '\0' && tokens[i].lastCharOperation == '\0')
+        {
+            words.push_back(tokens[i].word.compare("@") == 0 ? "" : tokens[i].word);
+            ++operandsCount;
+        }
+        else if (tokens[i].operation == '+' && operandsCount > 1)
+        {
+            --operandsCount;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+    if (operandsCount != 1)
+    {
+        return std::nullopt;
+    }
+    return words;
+}
+
 NondetermAutomaton Parser::solve()
 {
-    parse();
-    while (!autos.empty())
+    std::optional<std::vector<std::string>> words = getLiteralWords();
+    if (words && words->size() > 1)
     {
-        autos.pop();
+        // the words share their prefixes in the trie instead of being joined with epsilon transitions
+        return AhoCorasickAutomaton(*words).toNondetermAutomaton();
+    }
+
+    parseExpression();
+    graph = NondetermAutomaton();
+    while (!fragments.empty())
+    {
+        fragments.pop();
     }
 
     for (int i = 0; i < parsedString.size(); i++)
     {
         if (isAuto(parsedString[i]))
         {
-            autos.push(parsedString[i].first.value());
+            fragments.push(addFragment(*parsedString[i].first));
         }
-        else if (isOperation(parsedString[i].second.value()))
+        else
         {
-            NondetermAutomaton one = autos.top();
-            autos.pop();
+            Fragment one = popFragment();
 
             if (parsedString[i].second.value() == '*')
             {
-                NondetermAutomaton result = calculateKleeneStar(one);
-                autos.push(result);
+                fragments.push(calculateKleeneStar(one));
             }
             else
             {
-                NondetermAutomaton two = autos.top();
-                autos.pop();
-                NondetermAutomaton result = calculate(one, two, parsedString[i].second.value());
-                autos.push(result);
+                Fragment two = popFragment();
+                fragments.push(calculate(one, two, parsedString[i].second.value()));
             }
         }
     }
 
-    return autos.top();
+    // the fragments used by intersections are left in the graph, so only the reachable nodes are returned
+    NondetermAutomaton myAuto = extractFragment(popFragment());
+    graph = NondetermAutomaton();
+    return myAuto;
 }
@@ -9,28 +9,41 @@
 ///Class Parser parses a regular expression to an automaton.
 class Parser
 {
+    ///a part of the graph with a single first node and a single last node which is the final one
+    struct Fragment
+    {
+        int first;
+        int last;
+    };
+
     std::string expression;
     std::vector<std::pair<std::optional<NondetermAutomaton>, std::optional<char>>> parsedString;
-    std::stack<char> operations;
-    std::stack<NondetermAutomaton> autos;
-
-    ///checks whether the char is operation
-    bool isOperation(const char &symbol);
+    ///all fragments are built in one graph, the operations only add nodes and epsilon transitions to it
+    NondetermAutomaton graph;
+    std::stack<Fragment> fragments;
 
     //checks whether there is an auto in the pair
     bool isAuto(const std::pair<std::optional<NondetermAutomaton>, std::optional<char>> &);
 
-    ///gets an operation char and returns the operation's priority
-    int priority(const char &symbol);
+    ///fills parsedString with the automatons and the operations in postfix order
+    void parseExpression();
+
+    ///gets two fragments and returns the result of the operation on them
+    Fragment calculate(const Fragment &first, const Fragment &second, const char &oper);
 
-    ///returns the substring before the next operation char or the end of the string
-    std::string getString(const std::string &, int &);
+    ///returns the fragment transformed with Kleene star
+    Fragment calculateKleeneStar(const Fragment &first);
 
-    ///gets two automatons and returns the result of the operation on the automatons
-    NondetermAutomaton calculate(NondetermAutomaton &first, NondetermAutomaton &second, const char &oper);
+    ///adds the nodes of the auto to the graph and returns their fragment
+    Fragment addFragment(NondetermAutomaton &);
 
-    ///returns automaton with transformed with Kleene star
-    NondetermAutomaton calculateKleeneStar(NondetermAutomaton &first);
+    ///adds a node without transitions to the graph
+    int addGraphNode();
+
+    ///returns the nodes of the graph reachable from the first node of the fragment as an auto
+    NondetermAutomaton extractFragment(const Fragment &) const;
+
+    Fragment popFragment();
 
 public:
     Parser() = delete;
@@ -40,7 +53,10 @@ public:
     ///parses the expression to a vector of automatons and operations
     std::vector<std::pair<std::optional<NondetermAutomaton>, std::optional<char>>> parse();
 
-    ///uses parse() and then calculates the final result
+    ///returns the words of the expression if it is only a union of words
+    std::optional<std::vector<std::string>> getLiteralWords();
+
+    ///uses parse() and then calculates the final result, a union of words is built as a trie without epsilon transitions
     NondetermAutomaton solve();
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include "ahoCorasick.h"
+
+AhoCorasickAutomaton::AhoCorasickAutomaton(const std::vector<std::string> &words)
+{
+    std::vector<std::vector<std::pair<char, int>>> trie(1);
+    wordSizes.push_back(NO_STATE);
+    for (int i = 0; i < words.size(); ++i)
+    {
+        int state = ROOT;
+        for (int k = 0; k < words[i].size(); ++k)
+        {
+            int next = NO_STATE;
+            for (int j = 0; j < trie[state].size() && next == NO_STATE; ++j)
+            {
+                if (trie[state][j].first == words[i][k])
+                {
+                    next = trie[state][j].second;
+                }
+            }
+            if (next == NO_STATE)
+            {
+                next = trie.size();
+                trie[state].push_back(std::pair(words[i][k], next));
+                trie.emplace_back();
+                wordSizes.push_back(NO_STATE);
+            }
+            state = next;
+        }
+        wordSizes[state] = words[i].size();
+    }
+
+    childStarts.push_back(0);
+    for (int i = 0; i < trie.size(); ++i)
+    {
+        std::sort(trie[i].begin(), trie[i].end());
+        children.insert(children.end(), trie[i].begin(), trie[i].end());
+        childStarts.push_back(children.size());
+    }
+
+    rootNexts.assign(256, ROOT);
+    for (int k = childStarts[ROOT]; k < childStarts[ROOT + 1]; ++k)
+    {
+        rootNexts[(unsigned char)children[k].first] = children[k].second;
+    }
+
+    // the failure of a state is found from the failure of its parent, so the states are visited by their depth
+    failures.assign(trie.size(), ROOT);
+    outputs.assign(trie.size(), NO_STATE);
+    std::vector<int> listOfStates{ROOT};
+    for (int i = 0; i < listOfStates.size(); ++i)
+    {
+        int state = listOfStates[i];
+        for (int k = childStarts[state]; k < childStarts[state + 1]; ++k)
+        {
+            int child = children[k].second;
+            failures[child] = state == ROOT ? ROOT : transition(failures[state], children[k].first);
+            outputs[child] = wordSizes[failures[child]] != NO_STATE ? failures[child] : outputs[failures[child]];
+            listOfStates.push_back(child);
+        }
+    }
+}
+
+int AhoCorasickAutomaton::findChild(int state, const char &transitionChar) const
+{
+    auto first = children.begin() + childStarts[state];
+    auto last = children.begin() + childStarts[state + 1];
+    auto found = std::lower_bound(first, last, transitionChar, [](const std::pair<char, int> &child, const char &symbol)
+                                  { return child.first < symbol; });
+    return (found != last && found->first == transitionChar) ? found->second : NO_STATE;
+}
+
+bool AhoCorasickAutomaton::isWordFromAuto(std::string_view transitionWord) const
+{
+    int state = ROOT;
+    for (int i = 0; i < transitionWord.size() && state != NO_STATE; ++i)
+    {
+        state = findChild(state, transitionWord[i]);
+    }
+    return state != NO_STATE && wordSizes[state] != NO_STATE;
+}
+
+int AhoCorasickAutomaton::begin() const
+{
+    return ROOT;
+}
+
+int AhoCorasickAutomaton::transition(int state, const char &transitionChar) const
+{
+    while (state != ROOT)
+    {
+        int next = findChild(state, transitionChar);
+        if (next != NO_STATE)
+        {
+            return next;
+        }
+        state = failures[state];
+    }
+    return rootNexts[(unsigned char)transitionChar];
+}
+
+bool AhoCorasickAutomaton::isFinalState(int state) const
+{
+    return wordSizes[state] != NO_STATE || outputs[state] != NO_STATE;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> AhoCorasickAutomaton::findAll(std::string_view text) const
+{
+    std::vector<std::pair<std::size_t, std::size_t>> result;
+    if (wordSizes[ROOT] != NO_STATE)
+    {
+        result.push_back(std::pair(0, 0));
+    }
+    int state = ROOT;
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        state = transition(state, text[i]);
+        for (int found = wordSizes[state] != NO_STATE ? state : outputs[state]; found != NO_STATE; found = outputs[found])
+        {
+            result.push_back(std::pair(i + 1 - wordSizes[found], i + 1));
+        }
+    }
+    return result;
+}
+
+int AhoCorasickAutomaton::getStatesCount() const
+{
+    return wordSizes.size();
+}
+
+void AhoCorasickAutomaton::addToBuilder(AutoBuilder &builder) const
+{
+    builder.setFirst(ROOT);
+    builder.reserve(children.size());
+    for (int i = 0; i < wordSizes.size(); ++i)
+    {
+        for (int k = childStarts[i]; k < childStarts[i + 1]; ++k)
+        {
+            builder.addTransition(i, children[k].first, children[k].second);
+        }
+        if (wordSizes[i] != NO_STATE)
+        {
+            builder.addFinal(i);
+        }
+    }
+}
+
+DetermAutomaton AhoCorasickAutomaton::toDetermAutomaton() const
+{
+    AutoBuilder builder(wordSizes.size());
+    addToBuilder(builder);
+    return builder.toDetermAutomaton();
+}
+
+NondetermAutomaton AhoCorasickAutomaton::toNondetermAutomaton() const
+{
+    AutoBuilder builder(wordSizes.size());
+    addToBuilder(builder);
+    return builder.toNondetermAutomaton();
+}
@@ -0,0 +1,65 @@
+#ifndef AHO_CORASICK_H
+#define AHO_CORASICK_H
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "../Deterministic/determAuto.h"
+#include "../Nondeterministic/nondetermAuto.h"
+#include "../Nondeterministic/autoBuilder.h"
+
+///class AhoCorasickAutomaton finds many words in a text in one pass, the words are kept in a trie
+///and a failure transition of every state leads to the state of the longest suffix of its word which is in the trie
+class AhoCorasickAutomaton
+{
+    static constexpr int ROOT = 0;
+    static constexpr int NO_STATE = -1;
+
+    ///the transitions of state i sorted by char are from childStarts[i] to childStarts[i + 1]
+    std::vector<int> childStarts;
+    std::vector<std::pair<char, int>> children;
+    std::vector<int> failures;
+    ///the next state on the failure path at which a word ends or NO_STATE
+    std::vector<int> outputs;
+    ///the size of the word which ends at the state or NO_STATE
+    std::vector<int> wordSizes;
+    ///the transitions of the root with every char, most failure paths end at it
+    std::vector<int> rootNexts;
+
+    ///returns the state of the trie transition with the char or NO_STATE
+    int findChild(int state, const char &) const;
+
+    ///builds the trie to the builder, the states are numbered as in the auto
+    void addToBuilder(AutoBuilder &) const;
+
+public:
+    AhoCorasickAutomaton() = delete;
+
+    AhoCorasickAutomaton(const std::vector<std::string> &words);
+
+    ///checks whether the word is one of the words
+    bool isWordFromAuto(std::string_view) const;
+
+    ///returns the starting state
+    int begin() const;
+
+    ///returns the state of the longest suffix of the text read so far and the char which is in the trie
+    int transition(int state, const char &transitionChar) const;
+
+    ///checks whether one of the words is a suffix of the text read so far
+    bool isFinalState(int state) const;
+
+    ///returns the begin and the end of every occurrence of the words in the text ordered by their ends
+    std::vector<std::pair<std::size_t, std::size_t>> findAll(std::string_view text) const;
+
+    int getStatesCount() const;
+
+    ///returns the trie as a deterministic auto the language of which is the words
+    DetermAutomaton toDetermAutomaton() const;
+
+    ///returns the trie as a nondeterministic auto the language of which is the words
+    NondetermAutomaton toNondetermAutomaton() const;
+};
+
+#endif
@@ -0,0 +1,167 @@
+#include <unordered_map>
+#include "searcher.h"
+
+Searcher::Searcher(const NondetermAutomaton &myAuto, const LiteralPrefilter *_prefilter)
+    : anchored{myAuto.determinize().minimize()},
+      unanchored{myAuto.unanchored().determinize().minimize()},
+      reversed{myAuto.reversal().determinize().minimize()},
+      prefilter{_prefilter} {}
+
+Searcher::LiveStates Searcher::findLiveStates(std::string_view text, std::size_t from) const
+{
+    // a state is live before a char if it is final or the state after the char is live after it
+    int statesCount = anchored.getStatesCount();
+    StateSet finalStates(statesCount);
+    for (int state = 0; state < statesCount; ++state)
+    {
+        if (anchored.isFinalState(state))
+        {
+            finalStates.add(state);
+        }
+    }
+    LiveStates live{from, {finalStates}, std::vector<int>(text.size() - from + 1, 0)};
+    std::unordered_map<StateSet, int, StateSetHash> setIndices{{finalStates, 0}};
+    // the set after every char from every set, -1 is not computed yet
+    std::vector<int> nexts(256, -1);
+    for (std::size_t i = text.size(); i > from; --i)
+    {
+        int current = live.indices[i - from];
+        unsigned char symbol = text[i - 1];
+        if (nexts[current * 256 + symbol] == -1)
+        {
+            StateSet nextSet(finalStates);
+            for (int state = 0; state < statesCount; ++state)
+            {
+                if (live.sets[current].contains(anchored.transition(state, text[i - 1])))
+                {
+                    nextSet.add(state);
+                }
+            }
+            auto found = setIndices.find(nextSet);
+            if (found == setIndices.end())
+            {
+                found = setIndices.emplace(nextSet, live.sets.size()).first;
+                live.sets.push_back(nextSet);
+                nexts.resize(nexts.size() + 256, -1);
+            }
+            nexts[current * 256 + symbol] = found->second;
+        }
+        live.indices[i - 1 - from] = nexts[current * 256 + symbol];
+    }
+    return live;
+}
+
+std::size_t Searcher::findLongestEnd(std::string_view text, std::size_t start, const LiveStates &live) const
+{
+    int state = anchored.begin();
+    std::size_t end = anchored.isFinalState(state) ? start : std::string_view::npos;
+    for (std::size_t i = start; i < text.size(); ++i)
+    {
+        state = anchored.transition(state, text[i]);
+        if (!live.contains(i + 1, state))
+        {
+            break;
+        }
+        if (anchored.isFinalState(state))
+        {
+            end = i + 1;
+        }
+    }
+    return end;
+}
+
+std::size_t Searcher::findCandidate(std::string_view text, std::size_t from) const
+{
+    if (from > text.size())
+    {
+        return std::string_view::npos;
+    }
+    return prefilter ? prefilter->findCandidate(text, from) : from;
+}
+
+std::optional<Searcher::Match> Searcher::findFirst(std::string_view text, std::size_t from) const
+{
+    if (from > text.size() || (prefilter && !prefilter->mayContain(text.substr(from))))
+    {
+        return std::nullopt;
+    }
+    std::size_t start = findCandidate(text, from);
+    if (start == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+
+    int state = unanchored.begin();
+    std::size_t end = start;
+    while (!unanchored.isFinalState(state) && end < text.size() && !unanchored.isDeadState(state))
+    {
+        state = unanchored.transition(state, text[end++]);
+    }
+    if (!unanchored.isFinalState(state))
+    {
+        return std::nullopt;
+    }
+
+    // the reversed words are read back from the end, the last final state is the first start
+    state = reversed.begin();
+    std::size_t first = reversed.isFinalState(state) ? end : std::string_view::npos;
+    for (std::size_t i = end; i > start && !reversed.isDeadState(state); --i)
+    {
+        state = reversed.transition(state, text[i - 1]);
+        if (reversed.isFinalState(state))
+        {
+            first = i - 1;
+        }
+    }
+    return Match(first, end);
+}
+
+std::optional<Searcher::Match> Searcher::findLeftmostLongest(std::string_view text, std::size_t from) const
+{
+    if (from > text.size() || (prefilter && !prefilter->mayContain(text.substr(from))))
+    {
+        return std::nullopt;
+    }
+    std::size_t start = findCandidate(text, from);
+    if (start == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+    LiveStates live = findLiveStates(text, start);
+    for (; start != std::string_view::npos; start = findCandidate(text, start + 1))
+    {
+        if (live.contains(start, anchored.begin()))
+        {
+            return Match(start, findLongestEnd(text, start, live));
+        }
+    }
+    return std::nullopt;
+}
+
+std::vector<Searcher::Match> Searcher::findAll(std::string_view text) const
+{
+    std::vector<Match> result;
+    if (prefilter && !prefilter->mayContain(text))
+    {
+        return result;
+    }
+    std::size_t start = findCandidate(text, 0);
+    if (start == std::string_view::npos)
+    {
+        return result;
+    }
+    // the live states do not depend on the previous words, so they are found once for the whole text
+    LiveStates live = findLiveStates(text, start);
+    while (start != std::string_view::npos)
+    {
+        if (!live.contains(start, anchored.begin()))
+        {
+            start = findCandidate(text, start + 1);
+            continue;
+        }
+        std::size_t end = findLongestEnd(text, start, live);
+        result.push_back(Match(start, end));
+        start = findCandidate(text, end > start ? end : end + 1);
+    }
+    return result;
+}
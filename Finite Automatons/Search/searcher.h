@@ -0,0 +1,70 @@
+#ifndef SEARCHER_H
+#define SEARCHER_H
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "../Deterministic/compiledDetermAuto.h"
+#include "../Nondeterministic/nondetermAuto.h"
+#include "../Nondeterministic/stateSet.h"
+#include "../Regular expressions to auto/literalPrefilter.h"
+
+///class Searcher finds the words of the language of an auto inside a text without trying every substring,
+///with a prefilter of the expression of the auto the texts and the positions without its literals are skipped,
+///the first word is found with an auto of all words which end with a word from the language and its start with an auto
+///of the reversed words, the longest words are read only while the rest of the text still has a longer word,
+///so the autos read every char at most twice, a prefilter scans the text once more for its factor and once for the positions
+///of its prefix, with a union of words the scan for the positions rereads at most the longest word before every position
+class Searcher
+{
+    ///the words of the language
+    CompiledDetermAutomaton anchored;
+    ///all words which end with a word of the language
+    CompiledDetermAutomaton unanchored;
+    ///the reversed words of the language
+    CompiledDetermAutomaton reversed;
+    const LiteralPrefilter *prefilter;
+
+    ///the states of the anchored auto from which a word of the language is read from a position of the text
+    struct LiveStates
+    {
+        std::size_t from;
+        std::vector<StateSet> sets;
+        ///the index of the set of every position from the index to the end of the text
+        std::vector<int> indices;
+
+        bool contains(std::size_t position, int state) const { return sets[indices[position - from]].contains(state); }
+    };
+
+    ///finds the live states of every position reading the text once from its end to the index,
+    ///the sets of a position are built from the sets of the next one and the equal sets are kept once
+    LiveStates findLiveStates(std::string_view text, std::size_t from) const;
+
+    ///returns the first position from the index at which the prefix of the words is found or std::string_view::npos
+    std::size_t findCandidate(std::string_view text, std::size_t from) const;
+
+    ///returns the end of the longest word of the language which starts at the position,
+    ///the chars are read only while a word is still ahead, so a word must start at the position
+    std::size_t findLongestEnd(std::string_view text, std::size_t start, const LiveStates &) const;
+
+public:
+    ///the begin and the end of a word inside the text
+    using Match = std::pair<std::size_t, std::size_t>;
+
+    Searcher() = delete;
+
+    Searcher(const NondetermAutomaton &, const LiteralPrefilter *prefilter = nullptr);
+
+    ///returns the word which ends first from the index and from all such words the one which starts first
+    std::optional<Match> findFirst(std::string_view text, std::size_t from = 0) const;
+
+    ///returns the word which starts first from the index and from all such words the longest one
+    std::optional<Match> findLeftmostLongest(std::string_view text, std::size_t from = 0) const;
+
+    ///returns the leftmost longest words which do not overlap, the next word is searched from the end of the previous one
+    ///and an empty word is followed by a search from the next position
+    std::vector<Match> findAll(std::string_view text) const;
+};
+
+#endif
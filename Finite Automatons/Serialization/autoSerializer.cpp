@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include "autoSerializer.h"
+
+std::string AutoSerializer::serializeHelper(std::uint32_t kind, std::uint32_t first, const std::vector<bool> &finalStates,
+                                            std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions)
+{
+    SerializedHeader header;
+    std::memcpy(header.magic, SerializedHeader::MAGIC, sizeof(header.magic));
+    header.version = SerializedHeader::VERSION;
+    header.kind = kind;
+    header.statesCount = transitions.size();
+    header.first = first;
+    header.transitionsCount = 0;
+
+    std::vector<std::uint64_t> finals((transitions.size() + 63) / 64, 0);
+    std::vector<std::uint32_t> offsets{0};
+    std::vector<SerializedTransition> serializedTransitions;
+    for (int i = 0; i < transitions.size(); ++i)
+    {
+        if (finalStates[i])
+        {
+            finals[i / 64] |= std::uint64_t(1) << (i % 64);
+        }
+        for (int k = 0; k < transitions[i].size(); ++k)
+        {
+            SerializedTransition transition;
+            transition.target = transitions[i][k].second;
+            transition.symbol = transitions[i][k].first ? (unsigned char)*transitions[i][k].first : SerializedTransition::EPSILON;
+            transition.reserved = 0;
+            serializedTransitions.push_back(transition);
+        }
+        std::sort(serializedTransitions.begin() + offsets.back(), serializedTransitions.end(),
+                  [](const SerializedTransition &a, const SerializedTransition &b)
+                  { return a.symbol < b.symbol || (a.symbol == b.symbol && a.target < b.target); });
+        offsets.push_back(serializedTransitions.size());
+    }
+    header.transitionsCount = serializedTransitions.size();
+
+    std::string bytes;
+    bytes.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    bytes.append(reinterpret_cast<const char *>(finals.data()), finals.size() * sizeof(std::uint64_t));
+    bytes.append(reinterpret_cast<const char *>(offsets.data()), offsets.size() * sizeof(std::uint32_t));
+    bytes.append(reinterpret_cast<const char *>(serializedTransitions.data()),
+                 serializedTransitions.size() * sizeof(SerializedTransition));
+    return bytes;
+}
+
+std::string AutoSerializer::serialize(const DetermAutomaton &myAuto)
+{
+    if (myAuto.isEmpty())
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    // the reachable nodes are numbered in breadth-first order with the transitions sorted by symbol,
+    // so that equal autos built in a different order are serialized to the same bytes
+    std::vector<int> listOfNodes{myAuto.first};
+    std::vector<int> listOfIndices(myAuto.nodes.size(), DetermAutomaton::NO_NODE);
+    listOfIndices[myAuto.first] = 0;
+    std::vector<std::vector<std::pair<std::optional<char>, int>>> transitions;
+    for (int i = 0; i < listOfNodes.size(); ++i)
+    {
+        std::vector<std::pair<char, int>> nexts = myAuto.nodes[listOfNodes[i]].getNext();
+        std::sort(nexts.begin(), nexts.end(), [](const std::pair<char, int> &a, const std::pair<char, int> &b)
+                  { return (unsigned char)a.first < (unsigned char)b.first; });
+        transitions.push_back(std::vector<std::pair<std::optional<char>, int>>());
+        for (int k = 0; k < nexts.size(); ++k)
+        {
+            if (listOfIndices[nexts[k].second] == DetermAutomaton::NO_NODE)
+            {
+                listOfIndices[nexts[k].second] = listOfNodes.size();
+                listOfNodes.push_back(nexts[k].second);
+            }
+            transitions[i].push_back(std::pair(std::optional<char>(nexts[k].first), listOfIndices[nexts[k].second]));
+        }
+    }
+    std::vector<bool> finalStates(listOfNodes.size(), false);
+    for (int i = 0; i < listOfNodes.size(); ++i)
+    {
+        finalStates[i] = myAuto.finals[listOfNodes[i]];
+    }
+    return serializeHelper(SerializedHeader::DETERMINISTIC, 0, finalStates, transitions);
+}
+
+std::string AutoSerializer::serialize(const NondetermAutomaton &myAuto)
+{
+    if (myAuto.isEmpty())
+    {
+        throw std::out_of_range("Empty automaton");
+    }
+    std::vector<std::vector<std::pair<std::optional<char>, int>>> transitions;
+    myAuto.listTransitions(transitions);
+
+    return serializeHelper(SerializedHeader::NONDETERMINISTIC, myAuto.first, myAuto.finals, transitions);
+}
+
+void AutoSerializer::save(const std::string &bytes, const std::string &path)
+{
+    std::ofstream out(path, std::ios::binary);
+    out.write(bytes.data(), bytes.size());
+    if (!out)
+    {
+        throw std::invalid_argument("Cannot write file " + path);
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef AUTO_SERIALIZER_H
+#define AUTO_SERIALIZER_H
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+#include "serializedAuto.h"
+
+///class AutoSerializer writes autos in the binary format read by SerializedAutomaton
+class AutoSerializer
+{
+    ///writes the numbered states with their transitions, epsilon transitions have no char
+    static std::string serializeHelper(std::uint32_t kind, std::uint32_t first, const std::vector<bool> &finalStates,
+                                       std::vector<std::vector<std::pair<std::optional<char>, int>>> &transitions);
+
+public:
+    ///serializes the states reachable from the first node
+    static std::string serialize(const DetermAutomaton &);
+
+    static std::string serialize(const NondetermAutomaton &);
+
+    ///writes the serialized auto to the file and throws std::invalid_argument when it can not be written
+    static void save(const std::string &bytes, const std::string &path);
+};
+
+#endif
@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "serializedAuto.h"
+
+SerializedAutomaton::SerializedAutomaton(std::string_view bytes)
+{
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(std::uint64_t) != 0)
+    {
+        throw std::invalid_argument("Serialized automaton is not aligned");
+    }
+    if (bytes.size() < sizeof(SerializedHeader))
+    {
+        throw std::invalid_argument("Serialized automaton is too short");
+    }
+    header = reinterpret_cast<const SerializedHeader *>(bytes.data());
+    if (std::memcmp(header->magic, SerializedHeader::MAGIC, sizeof(header->magic)) != 0)
+    {
+        throw std::invalid_argument("Not a serialized automaton");
+    }
+    if (header->version != SerializedHeader::VERSION)
+    {
+        throw std::invalid_argument("Unsupported version " + std::to_string(header->version));
+    }
+    if (header->kind != SerializedHeader::DETERMINISTIC && header->kind != SerializedHeader::NONDETERMINISTIC)
+    {
+        throw std::invalid_argument("Unknown kind of automaton");
+    }
+    if (header->first >= header->statesCount)
+    {
+        throw std::invalid_argument("No starting node");
+    }
+
+    std::uint64_t finalsSize = (std::uint64_t(header->statesCount) + 63) / 64 * sizeof(std::uint64_t);
+    std::uint64_t offsetsSize = (std::uint64_t(header->statesCount) + 1) * sizeof(std::uint32_t);
+    std::uint64_t transitionsSize = std::uint64_t(header->transitionsCount) * sizeof(SerializedTransition);
+    if (bytes.size() != sizeof(SerializedHeader) + finalsSize + offsetsSize + transitionsSize)
+    {
+        throw std::invalid_argument("Serialized automaton has a wrong size");
+    }
+    finals = reinterpret_cast<const std::uint64_t *>(bytes.data() + sizeof(SerializedHeader));
+    offsets = reinterpret_cast<const std::uint32_t *>(bytes.data() + sizeof(SerializedHeader) + finalsSize);
+    transitions = reinterpret_cast<const SerializedTransition *>(bytes.data() + sizeof(SerializedHeader) + finalsSize + offsetsSize);
+
+    if (offsets[0] != 0 || offsets[header->statesCount] != header->transitionsCount)
+    {
+        throw std::invalid_argument("Wrong transition offsets");
+    }
+    for (std::uint32_t i = 0; i < header->statesCount; ++i)
+    {
+        if (offsets[i] > offsets[i + 1])
+        {
+            throw std::invalid_argument("Wrong transition offsets");
+        }
+        for (std::uint32_t k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            bool isSorted = k == offsets[i] || transitions[k - 1].symbol < transitions[k].symbol ||
+                            (!isDeterministic() && transitions[k - 1].symbol == transitions[k].symbol);
+            if (transitions[k].target >= header->statesCount || transitions[k].symbol > SerializedTransition::EPSILON ||
+                (isDeterministic() && transitions[k].symbol == SerializedTransition::EPSILON) || !isSorted)
+            {
+                throw std::invalid_argument("Wrong transition");
+            }
+        }
+    }
+}
+
+bool SerializedAutomaton::isDeterministic() const
+{
+    return header->kind == SerializedHeader::DETERMINISTIC;
+}
+
+int SerializedAutomaton::getStatesCount() const
+{
+    return header->statesCount;
+}
+
+int SerializedAutomaton::getTransitionsCount() const
+{
+    return header->transitionsCount;
+}
+
+int SerializedAutomaton::begin() const
+{
+    return header->first;
+}
+
+int SerializedAutomaton::transition(int state, const char &transitionChar) const
+{
+    if (!isDeterministic())
+    {
+        throw std::invalid_argument("Nondeterministic automaton");
+    }
+    if (state == DEAD_STATE)
+    {
+        return DEAD_STATE;
+    }
+    std::uint16_t symbol = (unsigned char)transitionChar;
+    const SerializedTransition *rowEnd = transitions + offsets[state + 1];
+    const SerializedTransition *found = std::lower_bound(transitions + offsets[state], rowEnd, symbol,
+                                                         [](const SerializedTransition &transition, std::uint16_t symbol)
+                                                         { return transition.symbol < symbol; });
+    if (found == rowEnd || found->symbol != symbol)
+    {
+        return DEAD_STATE;
+    }
+    return found->target;
+}
+
+bool SerializedAutomaton::isFinalState(int state) const
+{
+    return state != DEAD_STATE && ((finals[state / 64] >> (state % 64)) & 1);
+}
+
+bool SerializedAutomaton::isDeadState(int state) const
+{
+    return state == DEAD_STATE;
+}
+
+void SerializedAutomaton::addEpsilonClosure(std::uint32_t state, std::vector<std::uint32_t> &states, std::vector<char> &isAdded) const
+{
+    if (isAdded[state])
+    {
+        return;
+    }
+    isAdded[state] = true;
+    std::size_t begin = states.size();
+    states.push_back(state);
+    for (std::size_t i = begin; i < states.size(); ++i)
+    {
+        for (std::uint32_t k = offsets[states[i] + 1]; k > offsets[states[i]]; --k)
+        {
+            if (transitions[k - 1].symbol != SerializedTransition::EPSILON)
+            {
+                break;
+            }
+            if (!isAdded[transitions[k - 1].target])
+            {
+                isAdded[transitions[k - 1].target] = true;
+                states.push_back(transitions[k - 1].target);
+            }
+        }
+    }
+}
+
+bool SerializedAutomaton::isWordFromAuto(std::string_view transitionWord) const
+{
+    if (isDeterministic())
+    {
+        int state = begin();
+        for (int i = 0; i < transitionWord.size() && state != DEAD_STATE; ++i)
+        {
+            state = transition(state, transitionWord[i]);
+        }
+        return isFinalState(state);
+    }
+
+    std::vector<std::uint32_t> current, next;
+    std::vector<char> isAdded(header->statesCount, false);
+    addEpsilonClosure(header->first, current, isAdded);
+    for (int i = 0; i < transitionWord.size() && !current.empty(); ++i)
+    {
+        std::uint16_t symbol = (unsigned char)transitionWord[i];
+        std::fill(isAdded.begin(), isAdded.end(), false);
+        next.clear();
+        for (int j = 0; j < current.size(); ++j)
+        {
+            for (std::uint32_t k = offsets[current[j]]; k < offsets[current[j] + 1] && transitions[k].symbol <= symbol; ++k)
+            {
+                if (transitions[k].symbol == symbol)
+                {
+                    addEpsilonClosure(transitions[k].target, next, isAdded);
+                }
+            }
+        }
+        current.swap(next);
+    }
+    for (int j = 0; j < current.size(); ++j)
+    {
+        if (isFinalState(current[j]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::uint32_t> SerializedAutomaton::getReachableStates() const
+{
+    std::vector<std::uint32_t> states{header->first};
+    std::vector<char> isAdded(header->statesCount, false);
+    isAdded[header->first] = true;
+    for (int i = 0; i < states.size(); ++i)
+    {
+        for (std::uint32_t k = offsets[states[i]]; k < offsets[states[i] + 1]; ++k)
+        {
+            if (!isAdded[transitions[k].target])
+            {
+                isAdded[transitions[k].target] = true;
+                states.push_back(transitions[k].target);
+            }
+        }
+    }
+    return states;
+}
+
+void SerializedAutomaton::addToBuilder(AutoBuilder &builder) const
+{
+    std::vector<std::uint32_t> states = getReachableStates();
+    std::vector<int> indices(header->statesCount, 0);
+    for (int i = 0; i < states.size(); ++i)
+    {
+        indices[states[i]] = builder.addState();
+    }
+    builder.setFirst(0);
+    builder.reserve(offsets[header->statesCount]);
+    for (int i = 0; i < states.size(); ++i)
+    {
+        for (std::uint32_t k = offsets[states[i]]; k < offsets[states[i] + 1]; ++k)
+        {
+            if (transitions[k].symbol == SerializedTransition::EPSILON)
+            {
+                builder.addEpsilonTransition(i, indices[transitions[k].target]);
+            }
+            else
+            {
+                builder.addTransition(i, (char)transitions[k].symbol, indices[transitions[k].target]);
+            }
+        }
+        if (isFinalState(states[i]))
+        {
+            builder.addFinal(i);
+        }
+    }
+}
+
+DetermAutomaton SerializedAutomaton::toDetermAutomaton() const
+{
+    if (!isDeterministic())
+    {
+        throw std::invalid_argument("Nondeterministic automaton");
+    }
+    AutoBuilder builder;
+    addToBuilder(builder);
+    return builder.toDetermAutomaton();
+}
+
+NondetermAutomaton SerializedAutomaton::toNondetermAutomaton() const
+{
+    AutoBuilder builder;
+    addToBuilder(builder);
+    return builder.toNondetermAutomaton();
+}
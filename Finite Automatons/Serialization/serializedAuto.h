@@ -0,0 +1,93 @@
+#ifndef SERIALIZED_AUTOMATON_H
+#define SERIALIZED_AUTOMATON_H
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "../Deterministic/determAuto.h"
+#include "../Nondeterministic/nondetermAuto.h"
+#include "../Nondeterministic/autoBuilder.h"
+
+///the layout of a serialized auto, all numbers are in the byte order of the machine which wrote them:
+///the header, the final bitmap as 64-bit words, statesCount + 1 offsets of the first transition of every state
+///and the transitions of all states, sorted by symbol for every state
+struct SerializedHeader
+{
+    static constexpr char MAGIC[4] = {'F', 'A', 'U', 'T'};
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::uint32_t DETERMINISTIC = 0;
+    static constexpr std::uint32_t NONDETERMINISTIC = 1;
+
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t kind;
+    std::uint32_t statesCount;
+    std::uint32_t first;
+    std::uint32_t transitionsCount;
+};
+
+///a transition of a serialized auto, the symbol is the unsigned value of the char or EPSILON
+struct SerializedTransition
+{
+    static constexpr std::uint16_t EPSILON = 256;
+
+    std::uint32_t target;
+    std::uint16_t symbol;
+    std::uint16_t reserved;
+};
+
+///class SerializedAutomaton matches words directly from the bytes of a serialized auto, e.g. from a mapped file
+class SerializedAutomaton
+{
+    ///a missing transition of a deterministic auto leads to the dead state
+    static constexpr int DEAD_STATE = -1;
+
+    const SerializedHeader *header;
+    const std::uint64_t *finals;
+    const std::uint32_t *offsets;
+    const SerializedTransition *transitions;
+
+    ///returns the states reachable from the first state in breadth-first order
+    std::vector<std::uint32_t> getReachableStates() const;
+
+    ///adds the reachable states numbered in breadth-first order and their transitions to the builder
+    void addToBuilder(AutoBuilder &) const;
+
+    ///adds the state and the states reachable from it with epsilon transitions
+    void addEpsilonClosure(std::uint32_t state, std::vector<std::uint32_t> &states, std::vector<char> &isAdded) const;
+
+public:
+    SerializedAutomaton() = delete;
+
+    ///checks the layout and throws std::invalid_argument when the bytes are not a serialized auto,
+    ///the bytes must be aligned to 8 and must live as long as the SerializedAutomaton
+    SerializedAutomaton(std::string_view bytes);
+
+    bool isDeterministic() const;
+
+    int getStatesCount() const;
+
+    int getTransitionsCount() const;
+
+    ///returns the starting state
+    int begin() const;
+
+    ///returns the state reached from the state with the char, only for deterministic autos
+    int transition(int state, const char &transitionChar) const;
+
+    bool isFinalState(int state) const;
+
+    ///checks whether the state is the dead state of a deterministic auto
+    bool isDeadState(int state) const;
+
+    ///checks whether the word is from the language of the auto
+    bool isWordFromAuto(std::string_view) const;
+
+    ///builds a deterministic auto with nodes q0, q1, ... numbered in breadth-first order from the states reachable from the first state
+    DetermAutomaton toDetermAutomaton() const;
+
+    ///builds a nondeterministic auto with nodes q0, q1, ... numbered in breadth-first order from the states reachable from the first state
+    NondetermAutomaton toNondetermAutomaton() const;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef STREAM_MATCHER_H
+#define STREAM_MATCHER_H
+#include <cstddef>
+#include <string_view>
+
+///class StreamMatcher matches a word which arrives in chunks and keeps the state of the auto between them
+///the automaton must have begin(), transition(int, char), isFinalState(int) and isDeadState(int),
+///e.g. CompiledDetermAutomaton or LazyDetermAutomaton
+///a LazyDetermAutomaton must not be used elsewhere while a word is fed, clearing its cache renumbers its states
+template <class Automaton>
+class StreamMatcher
+{
+public:
+    enum class Status
+    {
+        ///the bytes fed so far form a word from the language
+        Accepting,
+        ///the bytes fed so far do not form a word from the language but more bytes may
+        Rejecting,
+        ///no continuation of the bytes fed so far is a word from the language
+        Dead
+    };
+
+private:
+    Automaton &myAuto;
+    int state;
+    std::size_t fedCount;
+
+public:
+    StreamMatcher() = delete;
+
+    StreamMatcher(Automaton &_myAuto) : myAuto{_myAuto}, state{_myAuto.begin()}, fedCount{0} {}
+
+    ///continues matching with the chunk and returns the status after it
+    Status feed(std::string_view chunk)
+    {
+        fedCount += chunk.size();
+        for (int i = 0; i < chunk.size() && !myAuto.isDeadState(state); ++i)
+        {
+            state = myAuto.transition(state, chunk[i]);
+        }
+        return getStatus();
+    }
+
+    ///starts matching a new word
+    void reset()
+    {
+        state = myAuto.begin();
+        fedCount = 0;
+    }
+
+    Status getStatus() const
+    {
+        if (myAuto.isFinalState(state))
+        {
+            return Status::Accepting;
+        }
+        if (myAuto.isDeadState(state))
+        {
+            return Status::Dead;
+        }
+        return Status::Rejecting;
+    }
+
+    ///checks whether the bytes fed so far form a word from the language
+    bool isAccepting() const
+    {
+        return getStatus() == Status::Accepting;
+    }
+
+    ///checks whether feeding more bytes can not change the result
+    bool isDead() const
+    {
+        return getStatus() == Status::Dead;
+    }
+
+    ///returns the number of bytes fed since the last reset
+    std::size_t getFedCount() const
+    {
+        return fedCount;
+    }
+};
+
+#endif